@@ -56,7 +56,10 @@ uint8_t ads1118_basic_init(ads1118_mode_t mode, ads1118_channel_t channel)
     DRIVER_ADS1118_LINK_SPI_INIT(&gs_handle, ads1118_interface_spi_init);
     DRIVER_ADS1118_LINK_SPI_DEINIT(&gs_handle, ads1118_interface_spi_deinit);
     DRIVER_ADS1118_LINK_SPI_TRANSMIT(&gs_handle, ads1118_interface_spi_transmit);
+    DRIVER_ADS1118_LINK_SPI_TRANSMIT_BATCH(&gs_handle, ads1118_interface_spi_transmit_batch);
     DRIVER_ADS1118_LINK_DELAY_MS(&gs_handle, ads1118_interface_delay_ms);
+    DRIVER_ADS1118_LINK_DELAY_US(&gs_handle, ads1118_interface_delay_us);
+    DRIVER_ADS1118_LINK_GET_TIME_US(&gs_handle, ads1118_interface_get_time_us);
     DRIVER_ADS1118_LINK_DEBUG_PRINT(&gs_handle, ads1118_interface_debug_print);
     
     /* ads1118 init */
@@ -56,7 +56,10 @@ uint8_t ads1118_shot_init(ads1118_mode_t mode, ads1118_channel_t channel)
     DRIVER_ADS1118_LINK_SPI_INIT(&gs_handle, ads1118_interface_spi_init);
     DRIVER_ADS1118_LINK_SPI_DEINIT(&gs_handle, ads1118_interface_spi_deinit);
     DRIVER_ADS1118_LINK_SPI_TRANSMIT(&gs_handle, ads1118_interface_spi_transmit);
+    DRIVER_ADS1118_LINK_SPI_TRANSMIT_BATCH(&gs_handle, ads1118_interface_spi_transmit_batch);
     DRIVER_ADS1118_LINK_DELAY_MS(&gs_handle, ads1118_interface_delay_ms);
+    DRIVER_ADS1118_LINK_DELAY_US(&gs_handle, ads1118_interface_delay_us);
+    DRIVER_ADS1118_LINK_GET_TIME_US(&gs_handle, ads1118_interface_get_time_us);
     DRIVER_ADS1118_LINK_DEBUG_PRINT(&gs_handle, ads1118_interface_debug_print);
     
     /* ads1118 init */
@@ -169,6 +172,69 @@ uint8_t ads1118_shot_read_temperature(float *deg)
     return 0;
 }
 
+/**
+ * @brief  shot example start
+ * @return status code
+ *         - 0 success
+ *         - 1 start failed
+ * @note   the function returns at once, poll ads1118_shot_is_ready and then call ads1118_shot_fetch
+ */
+uint8_t ads1118_shot_start(void)
+{
+    uint64_t ready_us;
+    
+    /* start the conversion */
+    if (ads1118_single_start(&gs_handle, &ready_us) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      shot example is ready
+ * @param[out] *ready pointer to a ready buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 check failed
+ * @note       ready is 1 when the conversion is finished
+ */
+uint8_t ads1118_shot_is_ready(uint8_t *ready)
+{
+    ads1118_bool_t enable;
+    
+    /* check the conversion */
+    if (ads1118_single_is_ready(&gs_handle, &enable) != 0)
+    {
+        return 1;
+    }
+    *ready = (uint8_t)enable;
+    
+    return 0;
+}
+
+/**
+ * @brief      shot example fetch
+ * @param[out] *s pointer to a converted adc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 fetch failed
+ * @note       none
+ */
+uint8_t ads1118_shot_fetch(float *s)
+{
+    int16_t raw;
+    
+    /* fetch the result */
+    if (ads1118_single_fetch(&gs_handle, (int16_t *)&raw, s) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
 /**
  * @brief  shot example deinit
  * @return status code
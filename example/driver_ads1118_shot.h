@@ -86,6 +86,35 @@ uint8_t ads1118_shot_read(float *s);
  */
 uint8_t ads1118_shot_read_temperature(float *deg);
 
+/**
+ * @brief  shot example start
+ * @return status code
+ *         - 0 success
+ *         - 1 start failed
+ * @note   the function returns at once, poll ads1118_shot_is_ready and then call ads1118_shot_fetch
+ */
+uint8_t ads1118_shot_start(void);
+
+/**
+ * @brief      shot example is ready
+ * @param[out] *ready pointer to a ready buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 check failed
+ * @note       ready is 1 when the conversion is finished
+ */
+uint8_t ads1118_shot_is_ready(uint8_t *ready);
+
+/**
+ * @brief      shot example fetch
+ * @param[out] *s pointer to a converted adc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 fetch failed
+ * @note       none
+ */
+uint8_t ads1118_shot_fetch(float *s);
+
 /**
  * @brief  shot example deinit
  * @return status code
@@ -80,6 +80,50 @@ uint8_t ads1118_interface_spi_deinit(void);
  */
 uint8_t ads1118_interface_spi_transmit(uint8_t *tx, uint8_t *rx, uint16_t len);
 
+/**
+ * @brief     interface spi bus transmit batch
+ * @param[in] *frame pointer to a frame buffer
+ * @param[in] num frame number
+ * @return    status code
+ *            - 0 success
+ *            - 1 transmit failed
+ * @note      cs is released between the frames
+ */
+uint8_t ads1118_interface_spi_transmit_batch(ads1118_frame_t *frame, uint16_t num);
+
+/**
+ * @brief     interface spi bus init with a user context
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 spi init failed
+ * @note      the user context selects the chip, it is defined by the platform
+ */
+uint8_t ads1118_interface_spi_init_ctx(void *user);
+
+/**
+ * @brief     interface spi bus deinit with a user context
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 spi deinit failed
+ * @note      the user context selects the chip, it is defined by the platform
+ */
+uint8_t ads1118_interface_spi_deinit_ctx(void *user);
+
+/**
+ * @brief      interface spi bus transmit with a user context
+ * @param[in]  *user pointer to a user context
+ * @param[in]  *tx pointer to a tx buffer
+ * @param[out] *rx pointer to a rx buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 transmit failed
+ * @note       the user context selects the chip, it is defined by the platform
+ */
+uint8_t ads1118_interface_spi_transmit_ctx(void *user, uint8_t *tx, uint8_t *rx, uint16_t len);
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -87,6 +131,20 @@ uint8_t ads1118_interface_spi_transmit(uint8_t *tx, uint8_t *rx, uint16_t len);
  */
 void ads1118_interface_delay_ms(uint32_t ms);
 
+/**
+ * @brief     interface delay us
+ * @param[in] us time
+ * @note      none
+ */
+void ads1118_interface_delay_us(uint32_t us);
+
+/**
+ * @brief  interface get time us
+ * @return monotonic time in us
+ * @note   none
+ */
+uint64_t ads1118_interface_get_time_us(void);
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
@@ -37,6 +37,7 @@
 #include "driver_ads1118_interface.h"
 #include "spi.h"
 #include <stdarg.h>
+#include <time.h>
 
 /**
  * @brief spi device name definition
@@ -87,6 +88,92 @@ uint8_t ads1118_interface_spi_transmit(uint8_t *tx, uint8_t *rx, uint16_t len)
     return spi_transmit(gs_fd, tx, rx ,len);
 }
 
+/**
+ * @brief     interface spi bus transmit batch
+ * @param[in] *frame pointer to a frame buffer
+ * @param[in] num frame number
+ * @return    status code
+ *            - 0 success
+ *            - 1 transmit failed
+ * @note      all frames are sent with one ioctl for every SPI_BATCH_MAX frames
+ */
+uint8_t ads1118_interface_spi_transmit_batch(ads1118_frame_t *frame, uint16_t num)
+{
+    spi_frame_t f[SPI_BATCH_MAX];
+    uint16_t i;
+    uint16_t n;
+    
+    while (num != 0)
+    {
+        /* copy the frames */
+        n = (num > SPI_BATCH_MAX) ? SPI_BATCH_MAX : num;
+        for (i = 0; i < n; i++)
+        {
+            f[i].tx = frame[i].tx;
+            f[i].rx = frame[i].rx;
+            f[i].len = frame[i].len;
+        }
+        
+        /* send them in one message */
+        if (spi_transmit_batch(gs_fd, f, n) != 0)
+        {
+            return 1;
+        }
+        frame += n;
+        num -= n;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     interface spi bus init with a user context
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 spi init failed
+ * @note      user points to a spi_device_t with the spidev name of the chip
+ */
+uint8_t ads1118_interface_spi_init_ctx(void *user)
+{
+    spi_device_t *dev = (spi_device_t *)user;
+    
+    return spi_init(dev->name, &dev->fd, SPI_MODE_TYPE_1, 1000 * 1000);
+}
+
+/**
+ * @brief     interface spi bus deinit with a user context
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 spi deinit failed
+ * @note      user points to a spi_device_t with the spidev name of the chip
+ */
+uint8_t ads1118_interface_spi_deinit_ctx(void *user)
+{
+    spi_device_t *dev = (spi_device_t *)user;
+    
+    return spi_deinit(dev->fd);
+}
+
+/**
+ * @brief      interface spi bus transmit with a user context
+ * @param[in]  *user pointer to a user context
+ * @param[in]  *tx pointer to a tx buffer
+ * @param[out] *rx pointer to a rx buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 transmit failed
+ * @note       user points to a spi_device_t with the spidev name of the chip
+ */
+uint8_t ads1118_interface_spi_transmit_ctx(void *user, uint8_t *tx, uint8_t *rx, uint16_t len)
+{
+    spi_device_t *dev = (spi_device_t *)user;
+    
+    return spi_transmit(dev->fd, tx, rx, len);
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -97,6 +184,30 @@ void ads1118_interface_delay_ms(uint32_t ms)
     usleep(ms * 1000);
 }
 
+/**
+ * @brief     interface delay us
+ * @param[in] us time
+ * @note      none
+ */
+void ads1118_interface_delay_us(uint32_t us)
+{
+    usleep(us);
+}
+
+/**
+ * @brief  interface get time us
+ * @return monotonic time in us
+ * @note   none
+ */
+uint64_t ads1118_interface_get_time_us(void)
+{
+    struct timespec t;
+    
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    
+    return (uint64_t)t.tv_sec * 1000000ULL + (uint64_t)t.tv_nsec / 1000ULL;
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      acquisition.h
+ * @brief     acquisition header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef ACQUISITION_H
+#define ACQUISITION_H
+
+#include "driver_ads1118.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup acquisition acquisition function
+ * @brief    acquisition function modules
+ * @{
+ */
+
+/**
+ * @brief acquisition config structure definition
+ */
+typedef struct acquisition_config_s
+{
+    ads1118_channel_t channel;        /**< adc channel */
+    ads1118_range_t range;            /**< adc range */
+    ads1118_rate_t rate;              /**< adc rate */
+    uint32_t period_us;               /**< sample period in us, 0 means the rate period */
+    int priority;                     /**< SCHED_FIFO priority, 0 means the default scheduler */
+    int cpu;                          /**< cpu affinity, -1 means any cpu */
+} acquisition_config_t;
+
+/**
+ * @brief     start the acquisition thread
+ * @param[in] *config pointer to an acquisition config structure
+ * @param[in] *ring pointer to an initialized ads1118 ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      the thread runs the chip in the continuous mode and pushes every sample into the ring,
+ *            a positive priority runs it under SCHED_FIFO with all the memory locked,
+ *            which needs root or CAP_SYS_NICE and CAP_IPC_LOCK
+ */
+uint8_t acquisition_start(const acquisition_config_t *config, ads1118_ring_t *ring);
+
+/**
+ * @brief  stop the acquisition thread
+ * @return status code
+ *         - 0 success
+ *         - 1 stop failed
+ * @note   none
+ */
+uint8_t acquisition_stop(void);
+
+/**
+ * @brief      get the missed deadline number
+ * @param[out] *missed pointer to a missed buffer
+ * @return     status code
+ *             - 0 success
+ * @note       a missed deadline is a period that could not be served in time,
+ *             the thread then restarts its schedule from the current time
+ */
+uint8_t acquisition_get_missed(uint32_t *missed);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -54,6 +54,11 @@ extern "C" {
  * @{
  */
 
+/**
+ * @brief spi batch definition
+ */
+#define SPI_BATCH_MAX        32        /**< max frames in one message */
+
 /**
  * @brief spi mode type enumeration definition
  */
@@ -65,6 +70,25 @@ typedef enum
     SPI_MODE_TYPE_3 = SPI_MODE_3,        /**< mode 3 */
 } spi_mode_type_t;
 
+/**
+ * @brief spi frame structure definition
+ */
+typedef struct spi_frame_s
+{
+    uint8_t *tx;        /**< tx buffer */
+    uint8_t *rx;        /**< rx buffer */
+    uint16_t len;       /**< frame length */
+} spi_frame_t;
+
+/**
+ * @brief spi device structure definition
+ */
+typedef struct spi_device_s
+{
+    char *name;        /**< device name, like "/dev/spidev0.1" */
+    int fd;            /**< device handle set by the init function */
+} spi_device_t;
+
 /**
  * @brief      spi bus init
  * @param[in]  *name pointer to a spi device name buffer
@@ -191,6 +215,19 @@ uint8_t spi_write_read(int fd, uint8_t *in_buf, uint32_t in_len, uint8_t *out_bu
  */
 uint8_t spi_transmit(int fd, uint8_t *tx, uint8_t *rx, uint16_t len);
 
+/**
+ * @brief     spi transmit batch
+ * @param[in] fd spi handle
+ * @param[in] *frame pointer to a frame buffer
+ * @param[in] num frame number
+ * @return    status code
+ *            - 0 success
+ *            - 1 transmit failed
+ * @note      all frames are sent with one ioctl and cs is released between the frames,
+ *            num can't be over SPI_BATCH_MAX
+ */
+uint8_t spi_transmit_batch(int fd, spi_frame_t *frame, uint16_t num);
+
 /**
  * @}
  */
@@ -0,0 +1,389 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      acquisition.c
+ * @brief     acquisition source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include "acquisition.h"
+#include "driver_ads1118_interface.h"
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <time.h>
+#include <sys/mman.h>
+
+/**
+ * @brief stack prefault size definition
+ */
+#define ACQUISITION_STACK_PREFAULT        (64 * 1024)        /**< 64KB */
+
+/**
+ * @brief rate period in us definition
+ */
+static const uint32_t gs_period_us[] =
+{
+    125000, 62500, 31250, 15625, 7813, 4000, 2106, 1163,
+};
+
+/**
+ * @brief acquisition var definition
+ */
+static ads1118_handle_t gs_handle;                  /**< ads1118 handle */
+static ads1118_ring_t *gs_ring;                     /**< sample ring */
+static pthread_t gs_thread;                         /**< acquisition thread */
+static uint32_t gs_period_ns;                       /**< sample period in ns */
+static uint8_t gs_locked;                           /**< memory locked flag */
+static volatile uint8_t gs_running;                 /**< running flag */
+static volatile uint32_t gs_missed;                 /**< missed deadline counter */
+
+/**
+ * @brief     add nanoseconds to a timespec
+ * @param[in] *t pointer to a timespec structure
+ * @param[in] ns added nanoseconds
+ * @note      none
+ */
+static void a_timespec_add(struct timespec *t, uint32_t ns)
+{
+    t->tv_nsec += ns;
+    while (t->tv_nsec >= 1000000000L)
+    {
+        t->tv_nsec -= 1000000000L;
+        t->tv_sec++;
+    }
+}
+
+/**
+ * @brief     check if a timespec is later than another one
+ * @param[in] *a pointer to a timespec structure
+ * @param[in] *b pointer to a timespec structure
+ * @return    1 if a is later than b, otherwise 0
+ * @note      none
+ */
+static int a_timespec_later(const struct timespec *a, const struct timespec *b)
+{
+    if (a->tv_sec != b->tv_sec)
+    {
+        return a->tv_sec > b->tv_sec;
+    }
+    
+    return a->tv_nsec > b->tv_nsec;
+}
+
+/**
+ * @brief  touch the thread stack
+ * @note   once touched the pages stay resident under mlockall
+ */
+static void a_stack_prefault(void)
+{
+    volatile uint8_t buf[ACQUISITION_STACK_PREFAULT];
+    size_t i;
+    
+    for (i = 0; i < sizeof(buf); i += 4096)
+    {
+        buf[i] = 0;
+    }
+}
+
+/**
+ * @brief     acquisition thread
+ * @param[in] *arg pointer to an argument
+ * @return    NULL
+ * @note      none
+ */
+static void *a_acquisition_thread(void *arg)
+{
+    struct timespec deadline;
+    struct timespec next;
+    struct timespec now;
+    ads1118_sample_t sample;
+    
+    (void)arg;
+    
+    /* make the stack resident */
+    a_stack_prefault();
+    
+    /* start from now */
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    
+    while (gs_running != 0)
+    {
+        /* sleep until the absolute deadline */
+        a_timespec_add(&deadline, gs_period_ns);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR)
+        {
+        }
+        
+        /* read the latest conversion with its fresh, duplicate or skipped status */
+        if (ads1118_continuous_read_sample(&gs_handle, &sample, 1) == 0)
+        {
+            (void)ads1118_ring_push(gs_ring, &sample);
+        }
+        
+        /* restart the schedule from now if the next deadline has already passed */
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        next = deadline;
+        a_timespec_add(&next, gs_period_ns);
+        if (a_timespec_later(&now, &next) != 0)
+        {
+            gs_missed++;
+            deadline = now;
+        }
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief     start the acquisition thread
+ * @param[in] *config pointer to an acquisition config structure
+ * @param[in] *ring pointer to an initialized ads1118 ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      the thread runs the chip in the continuous mode and pushes every sample into the ring,
+ *            a positive priority runs it under SCHED_FIFO with all the memory locked,
+ *            which needs root or CAP_SYS_NICE and CAP_IPC_LOCK
+ */
+uint8_t acquisition_start(const acquisition_config_t *config, ads1118_ring_t *ring)
+{
+    int res;
+    pthread_attr_t attr;
+    struct sched_param param;
+    cpu_set_t cpus;
+    
+    /* check the param */
+    if ((config == NULL) || (ring == NULL) || (config->rate > ADS1118_RATE_860SPS))
+    {
+        ads1118_interface_debug_print("acquisition: param is invalid.\n");
+        
+        return 1;
+    }
+    
+    /* check the scheduler */
+    if ((config->cpu >= CPU_SETSIZE) ||
+        ((config->priority > 0) &&
+        ((config->priority < sched_get_priority_min(SCHED_FIFO)) ||
+         (config->priority > sched_get_priority_max(SCHED_FIFO)))))
+    {
+        ads1118_interface_debug_print("acquisition: cpu or priority is invalid.\n");
+        
+        return 1;
+    }
+    
+    /* check the state */
+    if (gs_running != 0)
+    {
+        ads1118_interface_debug_print("acquisition: already running.\n");
+        
+        return 1;
+    }
+    
+    /* link interface function */
+    DRIVER_ADS1118_LINK_INIT(&gs_handle, ads1118_handle_t);
+    DRIVER_ADS1118_LINK_SPI_INIT(&gs_handle, ads1118_interface_spi_init);
+    DRIVER_ADS1118_LINK_SPI_DEINIT(&gs_handle, ads1118_interface_spi_deinit);
+    DRIVER_ADS1118_LINK_SPI_TRANSMIT(&gs_handle, ads1118_interface_spi_transmit);
+    DRIVER_ADS1118_LINK_SPI_TRANSMIT_BATCH(&gs_handle, ads1118_interface_spi_transmit_batch);
+    DRIVER_ADS1118_LINK_DELAY_MS(&gs_handle, ads1118_interface_delay_ms);
+    DRIVER_ADS1118_LINK_DELAY_US(&gs_handle, ads1118_interface_delay_us);
+    DRIVER_ADS1118_LINK_GET_TIME_US(&gs_handle, ads1118_interface_get_time_us);
+    DRIVER_ADS1118_LINK_DEBUG_PRINT(&gs_handle, ads1118_interface_debug_print);
+    
+    /* init the chip */
+    if (ads1118_init(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    
+    /* set the conversion */
+    if ((ads1118_set_mode(&gs_handle, ADS1118_MODE_ADC) != 0) ||
+        (ads1118_set_channel(&gs_handle, config->channel) != 0) ||
+        (ads1118_set_range(&gs_handle, config->range) != 0) ||
+        (ads1118_set_rate(&gs_handle, config->rate) != 0))
+    {
+        (void)ads1118_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* start the continuous mode */
+    if (ads1118_start_continuous_read(&gs_handle) != 0)
+    {
+        (void)ads1118_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* save the state */
+    gs_ring = ring;
+    gs_period_ns = ((config->period_us != 0) ? config->period_us : gs_period_us[config->rate]) * 1000;
+    gs_missed = 0;
+    gs_locked = 0;
+    
+    /* set the thread attr */
+    res = pthread_attr_init(&attr);
+    if (res != 0)
+    {
+        ads1118_interface_debug_print("acquisition: init attr failed, %s.\n", strerror(res));
+        (void)ads1118_stop_continuous_read(&gs_handle);
+        (void)ads1118_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (config->priority > 0)
+    {
+        /* lock all pages to avoid page faults in the loop */
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+        {
+            ads1118_interface_debug_print("acquisition: mlockall failed, %s.\n", strerror(errno));
+            
+            goto failed;
+        }
+        gs_locked = 1;
+        
+        /* set the real time scheduler */
+        memset(&param, 0, sizeof(param));
+        param.sched_priority = config->priority;
+        res = pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+        if (res == 0)
+        {
+            res = pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+        }
+        if (res == 0)
+        {
+            res = pthread_attr_setschedparam(&attr, &param);
+        }
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("acquisition: set scheduler failed, %s.\n", strerror(res));
+            
+            goto failed;
+        }
+    }
+    if (config->cpu >= 0)
+    {
+        /* pin the thread */
+        CPU_ZERO(&cpus);
+        CPU_SET(config->cpu, &cpus);
+        res = pthread_attr_setaffinity_np(&attr, sizeof(cpu_set_t), &cpus);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("acquisition: set affinity failed, %s.\n", strerror(res));
+            
+            goto failed;
+        }
+    }
+    
+    /* create the thread */
+    gs_running = 1;
+    res = pthread_create(&gs_thread, &attr, a_acquisition_thread, NULL);
+    if (res != 0)
+    {
+        ads1118_interface_debug_print("acquisition: create thread failed, %s.\n", strerror(res));
+        gs_running = 0;
+        
+        goto failed;
+    }
+    pthread_attr_destroy(&attr);
+    
+    return 0;
+    
+    failed:
+    pthread_attr_destroy(&attr);
+    if (gs_locked != 0)
+    {
+        munlockall();
+        gs_locked = 0;
+    }
+    (void)ads1118_stop_continuous_read(&gs_handle);
+    (void)ads1118_deinit(&gs_handle);
+    
+    return 1;
+}
+
+/**
+ * @brief  stop the acquisition thread
+ * @return status code
+ *         - 0 success
+ *         - 1 stop failed
+ * @note   none
+ */
+uint8_t acquisition_stop(void)
+{
+    uint8_t res;
+    
+    /* check the state */
+    if (gs_running == 0)
+    {
+        return 1;
+    }
+    
+    /* wait for the thread */
+    gs_running = 0;
+    pthread_join(gs_thread, NULL);
+    
+    /* unlock the pages */
+    if (gs_locked != 0)
+    {
+        munlockall();
+        gs_locked = 0;
+    }
+    
+    /* stop the chip */
+    res = ads1118_stop_continuous_read(&gs_handle);
+    if (ads1118_deinit(&gs_handle) != 0)
+    {
+        res = 1;
+    }
+    
+    return (res != 0) ? 1 : 0;
+}
+
+/**
+ * @brief      get the missed deadline number
+ * @param[out] *missed pointer to a missed buffer
+ * @return     status code
+ *             - 0 success
+ * @note       a missed deadline is a period that could not be served in time,
+ *             the thread then restarts its schedule from the current time
+ */
+uint8_t acquisition_get_missed(uint32_t *missed)
+{
+    *missed = gs_missed;
+    
+    return 0;
+}
@@ -512,3 +512,59 @@ uint8_t spi_transmit(int fd, uint8_t *tx, uint8_t *rx, uint16_t len)
     
     return 0;
 }
+
+/**
+ * @brief     spi transmit batch
+ * @param[in] fd spi handle
+ * @param[in] *frame pointer to a frame buffer
+ * @param[in] num frame number
+ * @return    status code
+ *            - 0 success
+ *            - 1 transmit failed
+ * @note      all frames are sent with one ioctl and cs is released between the frames,
+ *            num can't be over SPI_BATCH_MAX
+ */
+uint8_t spi_transmit_batch(int fd, spi_frame_t *frame, uint16_t num)
+{
+    int l;
+    uint16_t i;
+    uint32_t total;
+    struct spi_ioc_transfer k[SPI_BATCH_MAX];
+    
+    /* check the num */
+    if (num == 0)
+    {
+        return 0;
+    }
+    if (num > SPI_BATCH_MAX)
+    {
+        return 1;
+    }
+    
+    /* clear ioc transfer */
+    memset(k, 0, sizeof(struct spi_ioc_transfer) * num);
+    
+    /* set the param */
+    total = 0;
+    for (i = 0; i < num; i++)
+    {
+        k[i].tx_buf = (unsigned long)frame[i].tx;
+        k[i].rx_buf = (unsigned long)frame[i].rx;
+        k[i].len = frame[i].len;
+        
+        /* release cs after every frame but the last one */
+        k[i].cs_change = (i + 1 < num) ? 1 : 0;
+        total += frame[i].len;
+    }
+    
+    /* transmit */
+    l = ioctl(fd, SPI_IOC_MESSAGE(num), k);
+    if (l != (int)total)
+    {
+        perror("spi: length check error.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
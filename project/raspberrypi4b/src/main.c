@@ -39,6 +39,7 @@
 #include "driver_ads1118_register_test.h"
 #include "driver_ads1118_basic.h"
 #include "driver_ads1118_shot.h"
+#include "acquisition.h"
 #include <getopt.h>
 #include <stdlib.h>
 
@@ -71,11 +72,15 @@ uint8_t ads1118(uint8_t argc, char **argv)
         {"test", required_argument, NULL, 't'},
         {"channel", required_argument, NULL, 1},
         {"times", required_argument, NULL, 2},
+        {"priority", required_argument, NULL, 3},
+        {"cpu", required_argument, NULL, 4},
         {NULL, 0, NULL, 0},
     };
     char type[33] = "unknown";
     uint32_t times = 3;
     ads1118_channel_t channel = ADS1118_CHANNEL_AIN0_GND;
+    int priority = 0;
+    int cpu = -1;
 
     /* if no params */
     if (argc == 1)
@@ -199,6 +204,24 @@ uint8_t ads1118(uint8_t argc, char **argv)
                 break;
             }
 
+            /* thread priority */
+            case 3 :
+            {
+                /* set the priority */
+                priority = atoi(optarg);
+
+                break;
+            }
+
+            /* thread cpu */
+            case 4 :
+            {
+                /* set the cpu */
+                cpu = atoi(optarg);
+
+                break;
+            }
+
             /* the end */
             case -1 :
             {
@@ -349,6 +372,87 @@ uint8_t ads1118(uint8_t argc, char **argv)
 
         return 0;
     }
+    else if (strcmp("e_stream", type) == 0)
+    {
+        static ads1118_sample_t buf[1024];
+        ads1118_sample_t sample[64];
+        ads1118_ring_t ring;
+        acquisition_config_t config;
+        uint64_t last = 0;
+        uint32_t dt_min = 0xFFFFFFFFU;
+        uint32_t dt_max = 0;
+        uint32_t idle = 0;
+        uint32_t overrun;
+        uint32_t missed;
+        uint32_t len;
+        uint32_t i;
+        uint32_t j;
+
+        /* init the ring */
+        (void)ads1118_ring_init(&ring, buf, 1024);
+
+        /* start the acquisition */
+        config.channel = channel;
+        config.range = ADS1118_BASIC_DEFAULT_RANGE;
+        config.rate = ADS1118_BASIC_DEFAULT_RATE;
+        config.period_us = 0;
+        config.priority = priority;
+        config.cpu = cpu;
+        if (acquisition_start(&config, &ring) != 0)
+        {
+            ads1118_interface_debug_print("ads1118: acquisition start failed.\n");
+
+            return 1;
+        }
+        for (i = 0; i < times; )
+        {
+            /* get the samples */
+            len = 64;
+            (void)ads1118_ring_pop(&ring, sample, &len);
+            if (len == 0)
+            {
+                /* give up after 1s without a sample */
+                idle++;
+                if (idle >= 100)
+                {
+                    ads1118_interface_debug_print("ads1118: no sample in 1s.\n");
+                    (void)acquisition_stop();
+
+                    return 1;
+                }
+                ads1118_interface_delay_ms(10);
+
+                continue;
+            }
+            idle = 0;
+            for (j = 0; (j < len) && (i < times); j++, i++)
+            {
+                /* check the interval */
+                if (last != 0)
+                {
+                    uint32_t dt = (uint32_t)(sample[j].timestamp - last);
+
+                    dt_min = (dt < dt_min) ? dt : dt_min;
+                    dt_max = (dt > dt_max) ? dt : dt_max;
+                }
+                last = sample[j].timestamp;
+                ads1118_interface_debug_print("ads1118: %d/%d.\n", i + 1, times);
+                ads1118_interface_debug_print("ads1118: timestamp is %lluus raw is %d.\n",
+                                              (unsigned long long)sample[j].timestamp, sample[j].raw);
+            }
+        }
+        (void)ads1118_ring_get_overrun(&ring, &overrun);
+        (void)acquisition_get_missed(&missed);
+        (void)acquisition_stop();
+        if (dt_max != 0)
+        {
+            ads1118_interface_debug_print("ads1118: sample interval is %d - %dus.\n", dt_min, dt_max);
+        }
+        ads1118_interface_debug_print("ads1118: overrun is %d.\n", overrun);
+        ads1118_interface_debug_print("ads1118: missed deadline is %d.\n", missed);
+
+        return 0;
+    }
     else if (strcmp("h", type) == 0)
     {
         help:
@@ -365,15 +469,19 @@ uint8_t ads1118(uint8_t argc, char **argv)
         ads1118_interface_debug_print("  ads1118 (-e shot | --example=shot) [--times=<num>]\n");
         ads1118_interface_debug_print("          [--channel=<AIN0_AIN1 | AIN0_AIN3 | AIN1_AIN3 | AIN2_AIN3 | AIN0_GND | AIN1_GND | AIN2_GND | AIN3_GND>]\n");
         ads1118_interface_debug_print("  ads1118 (-e temperature | --example=temperature) [--times=<num>]\n");
+        ads1118_interface_debug_print("  ads1118 (-e stream | --example=stream) [--times=<num>] [--priority=<num>] [--cpu=<num>]\n");
+        ads1118_interface_debug_print("          [--channel=<AIN0_AIN1 | AIN0_AIN3 | AIN1_AIN3 | AIN2_AIN3 | AIN0_GND | AIN1_GND | AIN2_GND | AIN3_GND>]\n");
         ads1118_interface_debug_print("\n");
         ads1118_interface_debug_print("Options:\n");
         ads1118_interface_debug_print("      --channel=<AIN0_AIN1 | AIN0_AIN3 | AIN1_AIN3 | AIN2_AIN3 | AIN0_GND | AIN1_GND | AIN2_GND | AIN3_GND>\n");
         ads1118_interface_debug_print("                                         Set the ADC channel.([default: AIN0_GND])\n");
-        ads1118_interface_debug_print("  -e <read | shot | temperature>, --example=<read | shot | temperature>\n");
+        ads1118_interface_debug_print("      --cpu=<num>                        Pin the stream thread to a cpu.([default: any])\n");
+        ads1118_interface_debug_print("  -e <read | shot | temperature | stream>, --example=<read | shot | temperature | stream>\n");
         ads1118_interface_debug_print("                                         Run the driver example.\n");
         ads1118_interface_debug_print("  -h, --help                             Show the help.\n");
         ads1118_interface_debug_print("  -i, --information                      Show the chip information.\n");
         ads1118_interface_debug_print("  -p, --port                             Display the pin connections of the current board.\n");
+        ads1118_interface_debug_print("      --priority=<num>                   Set the SCHED_FIFO priority of the stream thread, 0 is the default scheduler.([default: 0])\n");
         ads1118_interface_debug_print("  -t <reg | read | muti>, --test=<reg | read | muti>.\n");
         ads1118_interface_debug_print("                                         Run the driver test.\n");
         ads1118_interface_debug_print("      --times=<num>                      Set the running times.([default: 3])\n");
@@ -0,0 +1,197 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      simulator_driver_ads1118_interface.c
+ * @brief     simulator driver ads1118 interface source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1118_interface.h"
+#include "ads1118_sim.h"
+#include <stdarg.h>
+
+/**
+ * @brief simulated chip definition
+ */
+ads1118_sim_t g_ads1118_sim;        /**< simulated chip */
+
+/**
+ * @brief  interface spi bus init
+ * @return status code
+ *         - 0 success
+ *         - 1 spi init failed
+ * @note   none
+ */
+uint8_t ads1118_interface_spi_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  interface spi bus deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 spi deinit failed
+ * @note   none
+ */
+uint8_t ads1118_interface_spi_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief      interface spi bus transmit
+ * @param[in]  *tx pointer to a tx buffer
+ * @param[out] *rx pointer to a rx buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 transmit failed
+ * @note       none
+ */
+uint8_t ads1118_interface_spi_transmit(uint8_t *tx, uint8_t *rx, uint16_t len)
+{
+    return ads1118_sim_transfer(&g_ads1118_sim, tx, rx, len);
+}
+
+/**
+ * @brief     interface spi bus transmit batch
+ * @param[in] *frame pointer to a frame buffer
+ * @param[in] num frame number
+ * @return    status code
+ *            - 0 success
+ *            - 1 transmit failed
+ * @note      every frame is a separate cs cycle of the simulated chip
+ */
+uint8_t ads1118_interface_spi_transmit_batch(ads1118_frame_t *frame, uint16_t num)
+{
+    uint16_t i;
+    
+    for (i = 0; i < num; i++)
+    {
+        if (ads1118_sim_transfer(&g_ads1118_sim, frame[i].tx, frame[i].rx, frame[i].len) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     interface spi bus init with a user context
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 spi init failed
+ * @note      user points to an ads1118_sim_t, so several simulated chips share the bus
+ */
+uint8_t ads1118_interface_spi_init_ctx(void *user)
+{
+    return (user != NULL) ? 0 : 1;
+}
+
+/**
+ * @brief     interface spi bus deinit with a user context
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 spi deinit failed
+ * @note      user points to an ads1118_sim_t, so several simulated chips share the bus
+ */
+uint8_t ads1118_interface_spi_deinit_ctx(void *user)
+{
+    return (user != NULL) ? 0 : 1;
+}
+
+/**
+ * @brief      interface spi bus transmit with a user context
+ * @param[in]  *user pointer to a user context
+ * @param[in]  *tx pointer to a tx buffer
+ * @param[out] *rx pointer to a rx buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 transmit failed
+ * @note       user points to an ads1118_sim_t, so several simulated chips share the bus
+ */
+uint8_t ads1118_interface_spi_transmit_ctx(void *user, uint8_t *tx, uint8_t *rx, uint16_t len)
+{
+    return ads1118_sim_transfer((ads1118_sim_t *)user, tx, rx, len);
+}
+
+/**
+ * @brief     interface delay ms
+ * @param[in] ms time
+ * @note      the simulated time is advanced, no real time is spent
+ */
+void ads1118_interface_delay_ms(uint32_t ms)
+{
+    ads1118_sim_delay(&g_ads1118_sim, (uint64_t)ms * 1000000ULL);
+}
+
+/**
+ * @brief     interface delay us
+ * @param[in] us time
+ * @note      the simulated time is advanced, no real time is spent
+ */
+void ads1118_interface_delay_us(uint32_t us)
+{
+    ads1118_sim_delay(&g_ads1118_sim, (uint64_t)us * 1000ULL);
+}
+
+/**
+ * @brief  interface get time us
+ * @return monotonic time in us
+ * @note   the simulated clock is returned
+ */
+uint64_t ads1118_interface_get_time_us(void)
+{
+    return ads1118_sim_get_time() / 1000ULL;
+}
+
+/**
+ * @brief     interface print format data
+ * @param[in] fmt format data
+ * @note      none
+ */
+void ads1118_interface_debug_print(const char *const fmt, ...)
+{
+    char str[256];
+    va_list args;
+    
+    memset((char *)str, 0, sizeof(char) * 256); 
+    va_start(args, fmt);
+    vsnprintf((char *)str, 255, (char const *)fmt, args);
+    va_end(args);
+    
+    (void)printf("%s", str);
+}
@@ -0,0 +1,178 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      ads1118_sim.h
+ * @brief     ads1118 simulator header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef ADS1118_SIM_H
+#define ADS1118_SIM_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup ads1118_sim ads1118 simulator function
+ * @brief    ads1118 simulator function modules
+ * @{
+ */
+
+/**
+ * @brief ads1118 sim wave enumeration definition
+ */
+typedef enum
+{
+    ADS1118_SIM_WAVE_DC   = 0x00,        /**< offset only */
+    ADS1118_SIM_WAVE_SINE = 0x01,        /**< offset + amplitude * sin(2 * pi * freq * t) */
+    ADS1118_SIM_WAVE_RAMP = 0x02,        /**< offset + amplitude * saw tooth from -1 to 1 at freq */
+} ads1118_sim_wave_t;
+
+/**
+ * @brief ads1118 sim input structure definition
+ */
+typedef struct ads1118_sim_input_s
+{
+    ads1118_sim_wave_t wave;        /**< wave type */
+    double offset;                  /**< offset in V */
+    double amplitude;               /**< amplitude in V */
+    double freq;                    /**< frequency in Hz */
+    double noise;                   /**< peak of the uniform noise in V */
+} ads1118_sim_input_t;
+
+/**
+ * @brief ads1118 sim stats structure definition
+ */
+typedef struct ads1118_sim_stats_s
+{
+    uint32_t transfers;             /**< spi transfer number */
+    uint32_t bytes;                 /**< spi byte number */
+    uint32_t writes;                /**< valid config write number */
+    uint32_t conversions;           /**< finished conversion number */
+    uint32_t drdy_reads;            /**< drdy read number */
+    uint64_t delay_ns;              /**< time spent in the delay functions */
+} ads1118_sim_stats_t;
+
+/**
+ * @brief ads1118 sim structure definition
+ */
+typedef struct ads1118_sim_s
+{
+    ads1118_sim_input_t input[8];   /**< input of every mux setting */
+    double temperature;             /**< die temperature in C */
+    uint32_t sclk_hz;               /**< spi clock */
+    int32_t clock_ppm;              /**< oscillator error in ppm */
+    uint16_t conf;                  /**< config register */
+    int16_t data;                   /**< conversion register */
+    uint8_t ready;                  /**< new data flag, dout/drdy is low when set */
+    uint8_t busy;                   /**< single shot conversion flag */
+    uint8_t running;                /**< continuous conversion flag */
+    uint64_t start_ns;              /**< conversion start time */
+    uint64_t done_ns;               /**< single shot conversion done time */
+    uint64_t last;                  /**< finished continuous conversion number */
+    uint32_t seed;                  /**< noise seed */
+    ads1118_sim_stats_t stats;      /**< stats */
+} ads1118_sim_t;
+
+/**
+ * @brief chip behind the ads1118 interface functions of the simulator project
+ */
+extern ads1118_sim_t g_ads1118_sim;
+
+/**
+ * @brief     reset a simulated chip to the power on state
+ * @param[in] *sim pointer to an ads1118 sim structure
+ * @note      all inputs are 0V, the die is 25C, sclk is 1MHz and the oscillator is exact
+ */
+void ads1118_sim_reset(ads1118_sim_t *sim);
+
+/**
+ * @brief     set the input of a mux setting
+ * @param[in] *sim pointer to an ads1118 sim structure
+ * @param[in] mux mux setting, the same value as ads1118_channel_t
+ * @param[in] *input pointer to an ads1118 sim input structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 mux is invalid
+ * @note      none
+ */
+uint8_t ads1118_sim_set_input(ads1118_sim_t *sim, uint8_t mux, const ads1118_sim_input_t *input);
+
+/**
+ * @brief      run one spi frame
+ * @param[in]  *sim pointer to an ads1118 sim structure
+ * @param[in]  *tx pointer to a tx buffer
+ * @param[out] *rx pointer to a rx buffer
+ * @param[in]  len frame length
+ * @return     status code
+ *             - 0 success
+ * @note       the frame takes len * 8 sclk periods of simulated time,
+ *             a 2 byte frame clocks out the conversion and a 4 byte frame also the config
+ */
+uint8_t ads1118_sim_transfer(ads1118_sim_t *sim, uint8_t *tx, uint8_t *rx, uint16_t len);
+
+/**
+ * @brief      read the dout/drdy level
+ * @param[in]  *sim pointer to an ads1118 sim structure
+ * @param[out] *level pointer to a level buffer
+ * @return     status code
+ *             - 0 success
+ * @note       level 0 means a new conversion is ready
+ */
+uint8_t ads1118_sim_drdy_read(ads1118_sim_t *sim, uint8_t *level);
+
+/**
+ * @brief     advance the simulated time
+ * @param[in] *sim pointer to an ads1118 sim structure
+ * @param[in] ns advanced time in ns
+ * @note      the time is shared by all simulated chips and counted as delay time of sim
+ */
+void ads1118_sim_delay(ads1118_sim_t *sim, uint64_t ns);
+
+/**
+ * @brief  get the simulated time
+ * @return time in ns
+ * @note   none
+ */
+uint64_t ads1118_sim_get_time(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
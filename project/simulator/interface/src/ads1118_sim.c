@@ -0,0 +1,347 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      ads1118_sim.c
+ * @brief     ads1118 simulator source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "ads1118_sim.h"
+#include <math.h>
+#include <string.h>
+
+/**
+ * @brief sim constant definition
+ */
+#define SIM_RESET_CONFIG        0x058B        /**< power on config */
+#define SIM_PI                  3.14159265358979323846        /**< pi */
+
+/**
+ * @brief data rate definition
+ */
+static const double gs_sps[8] = {8.0, 16.0, 32.0, 64.0, 128.0, 250.0, 475.0, 860.0};
+
+/**
+ * @brief full scale range definition
+ */
+static const double gs_fsr[8] = {6.144, 4.096, 2.048, 1.024, 0.512, 0.256, 0.256, 0.256};
+
+/**
+ * @brief simulated time definition
+ */
+static uint64_t gs_time_ns = 0;        /**< time in ns shared by all chips */
+
+/**
+ * @brief     get the conversion period
+ * @param[in] *sim pointer to an ads1118 sim structure
+ * @return    period in ns
+ * @note      a positive clock error makes the conversions faster
+ */
+static uint64_t a_sim_period(ads1118_sim_t *sim)
+{
+    double t;
+    
+    t = 1e9 / gs_sps[(sim->conf >> 5) & 0x07];
+    t /= 1.0 + (double)sim->clock_ppm * 1e-6;
+    
+    return (uint64_t)(t + 0.5);
+}
+
+/**
+ * @brief     get a uniform noise from -1 to 1
+ * @param[in] *sim pointer to an ads1118 sim structure
+ * @return    noise
+ * @note      xorshift32, so every run is the same
+ */
+static double a_sim_noise(ads1118_sim_t *sim)
+{
+    uint32_t x;
+    
+    x = sim->seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    sim->seed = x;
+    
+    return (double)x / 2147483648.0 - 1.0;
+}
+
+/**
+ * @brief     sample the input at the end of a conversion
+ * @param[in] *sim pointer to an ads1118 sim structure
+ * @param[in] t conversion end time in ns
+ * @return    conversion code
+ * @note      none
+ */
+static int16_t a_sim_sample(ads1118_sim_t *sim, uint64_t t)
+{
+    const ads1118_sim_input_t *in;
+    double s;
+    double v;
+    double code;
+    
+    /* temperature is a left justified 14 bit code of 0.03125C */
+    if ((sim->conf & (1 << 4)) != 0)
+    {
+        code = floor(sim->temperature / 0.03125 + 0.5);
+        code = (code > 8191.0) ? 8191.0 : ((code < -8192.0) ? -8192.0 : code);
+        
+        return (int16_t)((int32_t)code * 4);
+    }
+    
+    /* get the input voltage */
+    in = &sim->input[(sim->conf >> 12) & 0x07];
+    s = (double)t * 1e-9;
+    v = in->offset;
+    if (in->wave == ADS1118_SIM_WAVE_SINE)
+    {
+        v += in->amplitude * sin(2.0 * SIM_PI * in->freq * s);
+    }
+    else if (in->wave == ADS1118_SIM_WAVE_RAMP)
+    {
+        v += in->amplitude * (2.0 * (in->freq * s - floor(in->freq * s)) - 1.0);
+    }
+    if (in->noise != 0.0)
+    {
+        v += in->noise * a_sim_noise(sim);
+    }
+    
+    /* quantize with the pga */
+    code = floor(v / gs_fsr[(sim->conf >> 9) & 0x07] * 32768.0 + 0.5);
+    code = (code > 32767.0) ? 32767.0 : ((code < -32768.0) ? -32768.0 : code);
+    
+    return (int16_t)code;
+}
+
+/**
+ * @brief     bring the chip to the current time
+ * @param[in] *sim pointer to an ads1118 sim structure
+ * @note      none
+ */
+static void a_sim_update(ads1118_sim_t *sim)
+{
+    uint64_t t;
+    uint64_t k;
+    
+    if (sim->running != 0)
+    {
+        /* continuous conversions end at start + k * period */
+        t = a_sim_period(sim);
+        if (gs_time_ns >= sim->start_ns)
+        {
+            k = (gs_time_ns - sim->start_ns) / t;
+            if (k > sim->last)
+            {
+                sim->stats.conversions += (uint32_t)(k - sim->last);
+                sim->last = k;
+                sim->data = a_sim_sample(sim, sim->start_ns + k * t);
+                sim->ready = 1;
+            }
+        }
+    }
+    else if ((sim->busy != 0) && (gs_time_ns >= sim->done_ns))
+    {
+        /* the single shot conversion is done and the chip powers down */
+        sim->stats.conversions++;
+        sim->data = a_sim_sample(sim, sim->done_ns);
+        sim->ready = 1;
+        sim->busy = 0;
+    }
+}
+
+/**
+ * @brief     write the config register
+ * @param[in] *sim pointer to an ads1118 sim structure
+ * @param[in] word written word
+ * @note      none
+ */
+static void a_sim_write(ads1118_sim_t *sim, uint16_t word)
+{
+    uint16_t old;
+    
+    /* ss reads back 0 and the reserved bit reads back 1 */
+    old = sim->conf;
+    sim->conf = (word & 0x7FFE) | 0x0001;
+    sim->stats.writes++;
+    
+    if ((sim->conf & (1 << 8)) == 0)
+    {
+        /* continuous mode restarts on a new setting */
+        if ((sim->running == 0) || (((old ^ sim->conf) & 0x7FF8) != 0))
+        {
+            sim->running = 1;
+            sim->busy = 0;
+            sim->start_ns = gs_time_ns;
+            sim->last = 0;
+        }
+    }
+    else
+    {
+        /* single shot mode, ss starts a conversion if the chip is idle */
+        sim->running = 0;
+        if (((word & 0x8000) != 0) && (sim->busy == 0))
+        {
+            sim->busy = 1;
+            sim->done_ns = gs_time_ns + a_sim_period(sim);
+        }
+    }
+}
+
+/**
+ * @brief     reset a simulated chip to the power on state
+ * @param[in] *sim pointer to an ads1118 sim structure
+ * @note      all inputs are 0V, the die is 25C, sclk is 1MHz and the oscillator is exact
+ */
+void ads1118_sim_reset(ads1118_sim_t *sim)
+{
+    memset(sim, 0, sizeof(ads1118_sim_t));
+    sim->temperature = 25.0;
+    sim->sclk_hz = 1000000;
+    sim->conf = SIM_RESET_CONFIG;
+    sim->seed = 0x12345678;
+}
+
+/**
+ * @brief     set the input of a mux setting
+ * @param[in] *sim pointer to an ads1118 sim structure
+ * @param[in] mux mux setting, the same value as ads1118_channel_t
+ * @param[in] *input pointer to an ads1118 sim input structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 mux is invalid
+ * @note      none
+ */
+uint8_t ads1118_sim_set_input(ads1118_sim_t *sim, uint8_t mux, const ads1118_sim_input_t *input)
+{
+    if (mux > 7)
+    {
+        return 1;
+    }
+    sim->input[mux] = *input;
+    
+    return 0;
+}
+
+/**
+ * @brief      run one spi frame
+ * @param[in]  *sim pointer to an ads1118 sim structure
+ * @param[in]  *tx pointer to a tx buffer
+ * @param[out] *rx pointer to a rx buffer
+ * @param[in]  len frame length
+ * @return     status code
+ *             - 0 success
+ * @note       the frame takes len * 8 sclk periods of simulated time,
+ *             a 2 byte frame clocks out the conversion and a 4 byte frame also the config
+ */
+uint8_t ads1118_sim_transfer(ads1118_sim_t *sim, uint8_t *tx, uint8_t *rx, uint16_t len)
+{
+    uint16_t i;
+    uint16_t word;
+    
+    /* the conversion register is latched when cs goes low */
+    a_sim_update(sim);
+    sim->stats.transfers++;
+    sim->stats.bytes += len;
+    memset(rx, 0, len);
+    if (len >= 1)
+    {
+        rx[0] = (uint8_t)(((uint16_t)sim->data >> 8) & 0xFF);
+    }
+    if (len >= 2)
+    {
+        rx[1] = (uint8_t)((uint16_t)sim->data & 0xFF);
+        sim->ready = 0;
+    }
+    
+    /* the config is taken after the first 16 bits if the nop bits are 01 */
+    gs_time_ns += ((uint64_t)((len < 2) ? len : 2) * 8 * 1000000000ULL) / sim->sclk_hz;
+    if (len >= 2)
+    {
+        word = (uint16_t)(((uint16_t)tx[0] << 8) | tx[1]);
+        if (((word >> 1) & 0x03) == 0x01)
+        {
+            a_sim_write(sim, word);
+        }
+    }
+    
+    /* the next 16 bits read back the config */
+    if (len >= 4)
+    {
+        rx[2] = (uint8_t)((sim->conf >> 8) & 0xFF);
+        rx[3] = (uint8_t)(sim->conf & 0xFF);
+    }
+    if (len > 2)
+    {
+        i = len - 2;
+        gs_time_ns += ((uint64_t)i * 8 * 1000000000ULL) / sim->sclk_hz;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      read the dout/drdy level
+ * @param[in]  *sim pointer to an ads1118 sim structure
+ * @param[out] *level pointer to a level buffer
+ * @return     status code
+ *             - 0 success
+ * @note       level 0 means a new conversion is ready
+ */
+uint8_t ads1118_sim_drdy_read(ads1118_sim_t *sim, uint8_t *level)
+{
+    a_sim_update(sim);
+    sim->stats.drdy_reads++;
+    *level = (sim->ready != 0) ? 0 : 1;
+    
+    return 0;
+}
+
+/**
+ * @brief     advance the simulated time
+ * @param[in] *sim pointer to an ads1118 sim structure
+ * @param[in] ns advanced time in ns
+ * @note      the time is shared by all simulated chips and counted as delay time of sim
+ */
+void ads1118_sim_delay(ads1118_sim_t *sim, uint64_t ns)
+{
+    gs_time_ns += ns;
+    sim->stats.delay_ns += ns;
+}
+
+/**
+ * @brief  get the simulated time
+ * @return time in ns
+ * @note   none
+ */
+uint64_t ads1118_sim_get_time(void)
+{
+    return gs_time_ns;
+}
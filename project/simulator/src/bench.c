@@ -0,0 +1,984 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      bench.c
+ * @brief     bench source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L
+#endif
+#include "driver_ads1118_interface.h"
+#include "ads1118_sim.h"
+#include <getopt.h>
+#include <math.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief bench item structure definition
+ */
+typedef struct bench_item_s
+{
+    const char *name;                 /**< bench name */
+    uint8_t (*setup)(void);           /**< prepare the chip, can be NULL */
+    uint8_t (*run)(void);             /**< one api call */
+    uint32_t samples;                 /**< samples of one call */
+    double budget_transfers;          /**< max spi transfers per call */
+} bench_item_t;
+
+/**
+ * @brief bench bus definition
+ */
+#define BENCH_BUS_DEVICE        4     /**< simulated chips on the bus */
+
+/**
+ * @brief bench math definition
+ */
+#define BENCH_PI                3.14159265358979323846        /**< pi */
+
+/**
+ * @brief bench var definition
+ */
+static ads1118_handle_t gs_handle;    /**< ads1118 handle */
+static int16_t gs_raw[1024];          /**< raw buffer */
+static float gs_v[1024];              /**< voltage buffer */
+static uint32_t gs_toggle;            /**< setter toggle */
+static ads1118_sim_t gs_chip[BENCH_BUS_DEVICE];                 /**< simulated bus chips */
+static ads1118_handle_t gs_bus_handle[BENCH_BUS_DEVICE];        /**< bus chip handles */
+static ads1118_bus_device_t gs_device[BENCH_BUS_DEVICE];        /**< bus devices */
+static ads1118_bus_t gs_bus;                                    /**< ads1118 bus */
+static ads1118_sample_t gs_buf[64];                             /**< sample buffer */
+static ads1118_ring_t gs_ring;                                  /**< sample ring */
+static ads1118_filter_t gs_filter;                              /**< decimation filter */
+static int16_t gs_fir_coef[32];                                 /**< fir q15 coefficients */
+static int16_t gs_fir_history[64];                              /**< fir delay line */
+static int32_t gs_out[1024];                                    /**< filter output buffer */
+static int16_t gs_cal[1024];                                    /**< corrected raw buffer */
+static ads1118_thermocouple_t gs_tc;                            /**< thermocouple */
+static int32_t gs_uv[1024];                                     /**< microvolt buffer */
+static int32_t gs_mdeg[1024];                                   /**< temperature buffer in 0.001C */
+
+/**
+ * @brief four channel scan slots definition
+ */
+static const ads1118_slot_t gs_slot[4] =
+{
+    {ADS1118_CHANNEL_AIN0_GND, ADS1118_RANGE_4P096V, ADS1118_RATE_860SPS, ADS1118_MODE_ADC},
+    {ADS1118_CHANNEL_AIN1_GND, ADS1118_RANGE_4P096V, ADS1118_RATE_860SPS, ADS1118_MODE_ADC},
+    {ADS1118_CHANNEL_AIN2_GND, ADS1118_RANGE_4P096V, ADS1118_RATE_860SPS, ADS1118_MODE_ADC},
+    {ADS1118_CHANNEL_AIN3_GND, ADS1118_RANGE_4P096V, ADS1118_RATE_860SPS, ADS1118_MODE_ADC},
+};
+
+/**
+ * @brief     interface drdy read
+ * @param[in] *level pointer to a level buffer
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_drdy_read(uint8_t *level)
+{
+    return ads1118_sim_drdy_read(&g_ads1118_sim, level);
+}
+
+/**
+ * @brief     interface drdy read of a bus chip
+ * @param[in] *user pointer to a simulated chip
+ * @param[in] *level pointer to a level buffer
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_drdy_read_ctx(void *user, uint8_t *level)
+{
+    return ads1118_sim_drdy_read((ads1118_sim_t *)user, level);
+}
+
+/**
+ * @brief      get the bus traffic of all simulated chips
+ * @param[out] *stats pointer to a stats buffer
+ * @note       the delay time is counted by the main chip
+ */
+static void a_sim_stats(ads1118_sim_stats_t *stats)
+{
+    uint32_t i;
+    
+    *stats = g_ads1118_sim.stats;
+    for (i = 0; i < BENCH_BUS_DEVICE; i++)
+    {
+        stats->transfers += gs_chip[i].stats.transfers;
+        stats->bytes += gs_chip[i].stats.bytes;
+        stats->writes += gs_chip[i].stats.writes;
+        stats->drdy_reads += gs_chip[i].stats.drdy_reads;
+    }
+}
+
+/**
+ * @brief      get the driver counters of all handles
+ * @param[out] *stats pointer to a stats buffer
+ * @note       none
+ */
+static void a_driver_stats(ads1118_stats_t *stats)
+{
+    uint32_t i;
+    ads1118_stats_t s;
+    
+    (void)ads1118_get_stats(&gs_handle, stats);
+    for (i = 0; i < BENCH_BUS_DEVICE; i++)
+    {
+        (void)ads1118_get_stats(&gs_bus_handle[i], &s);
+        stats->transfers += s.transfers;
+        stats->bytes += s.bytes;
+        stats->drdy_reads += s.drdy_reads;
+        stats->samples += s.samples;
+    }
+}
+
+/**
+ * @brief  get the host time
+ * @return time in ns
+ * @note   none
+ */
+static uint64_t a_host_ns(void)
+{
+    struct timespec t;
+    
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    
+    return (uint64_t)t.tv_sec * 1000000000ULL + (uint64_t)t.tv_nsec;
+}
+
+/**
+ * @brief     compare two uint64_t
+ * @param[in] *a pointer to a value
+ * @param[in] *b pointer to a value
+ * @return    compare result
+ * @note      none
+ */
+static int a_compare(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief     get a percentile of a sorted buffer
+ * @param[in] *buf pointer to a sorted buffer
+ * @param[in] len buffer length
+ * @param[in] p percentile from 0 to 100
+ * @return    percentile value
+ * @note      nearest rank
+ */
+static uint64_t a_percentile(const uint64_t *buf, uint32_t len, uint32_t p)
+{
+    uint32_t i;
+    
+    i = (uint32_t)(((uint64_t)p * len + 99) / 100);
+    i = (i == 0) ? 0 : (i - 1);
+    
+    return buf[(i >= len) ? (len - 1) : i];
+}
+
+/**
+ * @brief  prepare the single shot 860 SPS mode
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_setup_single_860(void)
+{
+    uint8_t res = 0;
+    
+    res |= ads1118_stop_continuous_read(&gs_handle);
+    res |= ads1118_set_channel(&gs_handle, ADS1118_CHANNEL_AIN0_GND);
+    res |= ads1118_set_range(&gs_handle, ADS1118_RANGE_4P096V);
+    res |= ads1118_set_rate(&gs_handle, ADS1118_RATE_860SPS);
+    
+    return res;
+}
+
+/**
+ * @brief  prepare the single shot 128 SPS mode
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_setup_single_128(void)
+{
+    uint8_t res;
+    
+    res = a_setup_single_860();
+    res |= ads1118_set_rate(&gs_handle, ADS1118_RATE_128SPS);
+    
+    return res;
+}
+
+/**
+ * @brief  prepare the continuous 860 SPS mode
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_setup_continuous_860(void)
+{
+    uint8_t res;
+    
+    res = a_setup_single_860();
+    res |= ads1118_start_continuous_read(&gs_handle);
+    
+    return res;
+}
+
+/**
+ * @brief  prepare the lock step bus of four 860 SPS chips
+ * @return status code
+ * @note   the first round only starts the conversions
+ */
+static uint8_t a_setup_bus_round(void)
+{
+    uint8_t res;
+    
+    res = ads1118_bus_init(&gs_bus, gs_device, BENCH_BUS_DEVICE);
+    res |= ads1118_ring_init(&gs_ring, gs_buf, 64);
+    res |= ads1118_bus_round(&gs_bus, NULL);
+    
+    return res;
+}
+
+/**
+ * @brief  prepare the interleaved bus of four 860 SPS chips
+ * @return status code
+ * @note   the first poll only starts the conversions
+ */
+static uint8_t a_setup_bus_interleaved(void)
+{
+    uint8_t res;
+    uint32_t n;
+    
+    res = ads1118_bus_init(&gs_bus, gs_device, BENCH_BUS_DEVICE);
+    res |= ads1118_ring_init(&gs_ring, gs_buf, 64);
+    res |= ads1118_bus_poll(&gs_bus, NULL, &n);
+    
+    return res;
+}
+
+/**
+ * @brief  fill the raw buffer with a noisy input
+ * @note   none
+ */
+static void a_filter_input(void)
+{
+    uint32_t i;
+    uint32_t x;
+    
+    x = 0x12345678;
+    for (i = 0; i < 1024; i++)
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        gs_raw[i] = (int16_t)(12000 + (int32_t)(x & 0xFF) - 128);
+    }
+}
+
+/**
+ * @brief  prepare the boxcar decimator by 16
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_setup_filter_boxcar(void)
+{
+    a_filter_input();
+    
+    return ads1118_filter_boxcar_init(&gs_filter, 16);
+}
+
+/**
+ * @brief  prepare the third order cic decimator by 16
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_setup_filter_cic(void)
+{
+    a_filter_input();
+    
+    return ads1118_filter_cic_init(&gs_filter, 16, 3);
+}
+
+/**
+ * @brief  prepare the 32 tap fir decimator by 16
+ * @return status code
+ * @note   hamming windowed sinc with the cutoff at the output nyquist
+ */
+static uint8_t a_setup_filter_fir(void)
+{
+    double h[32];
+    double sum;
+    double m;
+    int32_t total;
+    uint32_t i;
+    
+    a_filter_input();
+    sum = 0.0;
+    for (i = 0; i < 32; i++)
+    {
+        m = (double)i - 15.5;
+        h[i] = sin(BENCH_PI * m / 16.0) / (BENCH_PI * m) * (0.54 - 0.46 * cos(2.0 * BENCH_PI * i / 31.0));
+        sum += h[i];
+    }
+    total = 0;
+    for (i = 0; i < 32; i++)
+    {
+        gs_fir_coef[i] = (int16_t)floor(h[i] / sum * 32768.0 + 0.5);
+        total += gs_fir_coef[i];
+    }
+    gs_fir_coef[15] = (int16_t)(gs_fir_coef[15] + 32768 - total);
+    
+    return ads1118_filter_fir_init(&gs_filter, 16, gs_fir_coef, gs_fir_history, 32);
+}
+
+/**
+ * @brief  prepare the continuous 860 SPS mode with the cic decimator
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_setup_continuous_filter(void)
+{
+    uint8_t res;
+    
+    res = a_setup_continuous_860();
+    res |= ads1118_filter_cic_init(&gs_filter, 16, 3);
+    
+    return res;
+}
+
+/**
+ * @brief  drop all samples in the ring
+ * @note   none
+ */
+static void a_bus_drain(void)
+{
+    uint32_t len;
+    
+    len = 64;
+    (void)ads1118_ring_pop(&gs_ring, gs_buf, &len);
+}
+
+/**
+ * @brief  run the setter bench
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_run_set_channel(void)
+{
+    gs_toggle ^= 1;
+    
+    return ads1118_set_channel(&gs_handle, (gs_toggle != 0) ? ADS1118_CHANNEL_AIN1_GND : ADS1118_CHANNEL_AIN0_GND);
+}
+
+/**
+ * @brief  run the getter bench
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_run_get_channel(void)
+{
+    ads1118_channel_t channel;
+    
+    return ads1118_get_channel(&gs_handle, &channel);
+}
+
+/**
+ * @brief  run the batched setters bench
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_run_batch_setters(void)
+{
+    uint8_t res;
+    
+    gs_toggle ^= 1;
+    res = ads1118_batch_begin(&gs_handle);
+    res |= ads1118_set_channel(&gs_handle, (gs_toggle != 0) ? ADS1118_CHANNEL_AIN1_GND : ADS1118_CHANNEL_AIN0_GND);
+    res |= ads1118_set_range(&gs_handle, (gs_toggle != 0) ? ADS1118_RANGE_2P048V : ADS1118_RANGE_4P096V);
+    res |= ads1118_set_rate(&gs_handle, (gs_toggle != 0) ? ADS1118_RATE_475SPS : ADS1118_RATE_860SPS);
+    res |= ads1118_batch_end(&gs_handle);
+    
+    return res;
+}
+
+/**
+ * @brief  run the single read bench
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_run_single_read(void)
+{
+    return ads1118_single_read(&gs_handle, &gs_raw[0], &gs_v[0]);
+}
+
+/**
+ * @brief  run the continuous read bench
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_run_continuous_read(void)
+{
+    return ads1118_continuous_read(&gs_handle, &gs_raw[0], &gs_v[0]);
+}
+
+/**
+ * @brief  run the continuous read block bench
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_run_continuous_read_block(void)
+{
+    return ads1118_continuous_read_block(&gs_handle, gs_raw, gs_v, 64);
+}
+
+/**
+ * @brief  run the convert and fetch bench
+ * @return status code
+ * @note   the caller waits the conversion between two calls
+ */
+static uint8_t a_run_convert_and_fetch(void)
+{
+    uint8_t res;
+    
+    res = ads1118_convert_and_fetch(&gs_handle, &gs_slot[0], &gs_raw[0]);
+    ads1118_interface_delay_us(1163 + 116);
+    
+    return res;
+}
+
+/**
+ * @brief  run the scan bench
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_run_scan(void)
+{
+    return ads1118_scan(&gs_handle, gs_slot, 4, gs_raw, gs_v);
+}
+
+/**
+ * @brief  run the lock step bus bench
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_run_bus_round(void)
+{
+    uint8_t res;
+    
+    res = ads1118_bus_round(&gs_bus, &gs_ring);
+    a_bus_drain();
+    
+    return res;
+}
+
+/**
+ * @brief  run the interleaved bus bench
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_run_bus_run(void)
+{
+    uint8_t res;
+    
+    res = ads1118_bus_run(&gs_bus, &gs_ring, BENCH_BUS_DEVICE);
+    a_bus_drain();
+    
+    return res;
+}
+
+/**
+ * @brief  run the bulk convert bench
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_run_raw_to_volts_n(void)
+{
+    return ads1118_raw_to_volts_n(ADS1118_RANGE_4P096V, gs_raw, gs_v, 1024);
+}
+
+/**
+ * @brief  prepare the calibration of AIN0_GND in the 4.096V range
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_setup_calibration(void)
+{
+    ads1118_calibration_t cal;
+    
+    a_filter_input();
+    cal.offset = 12;
+    cal.gain = 32900;
+    
+    return ads1118_set_calibration_entry(&gs_handle, ADS1118_CHANNEL_AIN0_GND, ADS1118_RANGE_4P096V, &cal);
+}
+
+/**
+ * @brief  run the application side offset and gain pass
+ * @return status code
+ * @note   the separate loop the calibrated conversion replaces
+ */
+static uint8_t a_run_float_calibrate(void)
+{
+    uint32_t i;
+    
+    for (i = 0; i < 1024; i++)
+    {
+        gs_v[i] = ((float)gs_raw[i] * 4.096f / 32768.0f - 12.0f * 4.096f / 32768.0f) * (32900.0f / 32768.0f);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  run the float calibration bench
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_run_calibrate_to_volts_n(void)
+{
+    return ads1118_calibrate_to_volts_n(&gs_handle, ADS1118_CHANNEL_AIN0_GND, ADS1118_RANGE_4P096V, gs_raw, gs_v, 1024);
+}
+
+/**
+ * @brief  run the integer calibration bench
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_run_calibrate_n(void)
+{
+    return ads1118_calibrate_n(&gs_handle, ADS1118_CHANNEL_AIN0_GND, ADS1118_RANGE_4P096V, gs_raw, gs_cal, 1024);
+}
+
+/**
+ * @brief  prepare a k type thermocouple in the 0.256V range
+ * @return status code
+ * @note   the codes cover -5.5mV to 50.5mV with a 25C cold junction
+ */
+static uint8_t a_setup_thermocouple(void)
+{
+    uint32_t i;
+    
+    for (i = 0; i < 1024; i++)
+    {
+        gs_raw[i] = (int16_t)((int32_t)i * 7 - 700);
+    }
+    if (ads1118_thermocouple_init(&gs_tc, ADS1118_THERMOCOUPLE_TYPE_K, ADS1118_CHANNEL_AIN2_AIN3,
+                                  ADS1118_RANGE_0P256V, ADS1118_RATE_860SPS, 1) != 0)
+    {
+        return 1;
+    }
+    
+    return ads1118_thermocouple_set_cold_junction(&gs_tc, 25.0f);
+}
+
+/**
+ * @brief  run the polynomial thermocouple bench
+ * @return status code
+ * @note   raw to microvolts and the nist inverse polynomial of every sample
+ */
+static uint8_t a_run_thermocouple_convert_n(void)
+{
+    uint32_t i;
+    
+    for (i = 0; i < 1024; i++)
+    {
+        (void)ads1118_raw_to_microvolts(ADS1118_RANGE_0P256V, gs_raw[i], &gs_uv[i]);
+    }
+    
+    return ads1118_thermocouple_convert_n(&gs_tc, gs_uv, gs_v, 1024);
+}
+
+/**
+ * @brief  run the lookup table thermocouple bench
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_run_thermocouple_raw_to_mdeg_n(void)
+{
+    return ads1118_thermocouple_raw_to_mdeg_n(&gs_tc, gs_raw, gs_mdeg, 1024);
+}
+
+/**
+ * @brief  run the per sample float average bench
+ * @return status code
+ * @note   the application side averaging the filters replace
+ */
+static uint8_t a_run_float_average(void)
+{
+    uint32_t i;
+    float sum;
+    
+    sum = 0.0f;
+    for (i = 0; i < 1024; i++)
+    {
+        sum += (float)gs_raw[i] * 4.096f / 32768.0f;
+        if ((i & 15) == 15)
+        {
+            gs_v[i >> 4] = sum / 16.0f;
+            sum = 0.0f;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  run the filter bench
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_run_filter(void)
+{
+    uint32_t n;
+    
+    return ads1118_filter_process(&gs_filter, gs_raw, 1024, gs_out, &n);
+}
+
+/**
+ * @brief  run the continuous read filter bench
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_run_continuous_read_filter(void)
+{
+    return ads1118_continuous_read_filter(&gs_handle, &gs_filter, gs_out, 4);
+}
+
+/**
+ * @brief bench item list definition
+ */
+static const bench_item_t gs_item[] =
+{
+    {"set_channel", NULL, a_run_set_channel, 0, 1.0},
+    {"get_channel", NULL, a_run_get_channel, 0, 0.0},
+    {"batch_setters_3", NULL, a_run_batch_setters, 0, 1.0},
+    {"single_read_860sps", a_setup_single_860, a_run_single_read, 1, 2.0},
+    {"single_read_128sps", a_setup_single_128, a_run_single_read, 1, 2.0},
+    {"convert_and_fetch_860sps", a_setup_single_860, a_run_convert_and_fetch, 1, 1.0},
+    {"scan_4_860sps", a_setup_single_860, a_run_scan, 4, 5.0},
+    {"continuous_read_860sps", a_setup_continuous_860, a_run_continuous_read, 1, 1.0},
+    {"continuous_read_block_64_860sps", a_setup_continuous_860, a_run_continuous_read_block, 64, 64.0},
+    {"bus_round_4x860sps", a_setup_bus_round, a_run_bus_round, 4, 4.0},
+    {"bus_interleaved_4x860sps", a_setup_bus_interleaved, a_run_bus_run, 4, 4.0},
+    {"raw_to_volts_n_1024", NULL, a_run_raw_to_volts_n, 1024, 0.0},
+    {"float_calibrate_1024", a_setup_calibration, a_run_float_calibrate, 1024, 0.0},
+    {"calibrate_to_volts_n_1024", a_setup_calibration, a_run_calibrate_to_volts_n, 1024, 0.0},
+    {"calibrate_n_1024", a_setup_calibration, a_run_calibrate_n, 1024, 0.0},
+    {"thermocouple_convert_n_1024", a_setup_thermocouple, a_run_thermocouple_convert_n, 1024, 0.0},
+    {"thermocouple_raw_to_mdeg_n_1024", a_setup_thermocouple, a_run_thermocouple_raw_to_mdeg_n, 1024, 0.0},
+    {"float_average_16_1024", a_setup_filter_boxcar, a_run_float_average, 1024, 0.0},
+    {"filter_boxcar_16_1024", a_setup_filter_boxcar, a_run_filter, 1024, 0.0},
+    {"filter_cic3_16_1024", a_setup_filter_cic, a_run_filter, 1024, 0.0},
+    {"filter_fir32_16_1024", a_setup_filter_fir, a_run_filter, 1024, 0.0},
+    {"continuous_read_filter_cic3_16_860sps", a_setup_continuous_filter, a_run_continuous_read_filter, 4, 64.0},
+};
+
+/**
+ * @brief     run one bench item
+ * @param[in] *item pointer to a bench item
+ * @param[in] times call times
+ * @param[in] *host pointer to a host latency buffer
+ * @param[in] *sim pointer to a simulated latency buffer
+ * @param[in] first first item flag
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 6 over the budget
+ * @note      none
+ */
+static uint8_t a_bench_run(const bench_item_t *item, uint32_t times, uint64_t *host, uint64_t *sim, uint8_t first)
+{
+    ads1118_sim_stats_t s0;
+    ads1118_sim_stats_t s1;
+    ads1118_stats_t d0;
+    ads1118_stats_t d1;
+    uint64_t t0;
+    uint64_t t1;
+    uint64_t h0;
+    uint64_t h1;
+    uint64_t total;
+    uint32_t i;
+    double calls;
+    double transfers;
+    uint8_t pass;
+    
+    /* prepare */
+    if ((item->setup != NULL) && (item->setup() != 0))
+    {
+        return 1;
+    }
+    
+    /* run and record the latency of every call */
+    a_sim_stats(&s0);
+    a_driver_stats(&d0);
+    t0 = ads1118_sim_get_time();
+    h0 = a_host_ns();
+    for (i = 0; i < times; i++)
+    {
+        uint64_t h = a_host_ns();
+        uint64_t s = ads1118_sim_get_time();
+        
+        if (item->run() != 0)
+        {
+            return 1;
+        }
+        host[i] = a_host_ns() - h;
+        sim[i] = ads1118_sim_get_time() - s;
+    }
+    h1 = a_host_ns();
+    t1 = ads1118_sim_get_time();
+    a_sim_stats(&s1);
+    a_driver_stats(&d1);
+    qsort(host, times, sizeof(uint64_t), a_compare);
+    qsort(sim, times, sizeof(uint64_t), a_compare);
+    
+    /* check the budget */
+    calls = (double)times;
+    transfers = (double)(s1.transfers - s0.transfers) / calls;
+    pass = (transfers <= item->budget_transfers + 1e-9) ? 1 : 0;
+    
+    /* the driver counters must see the same bus traffic as the chip */
+    if (((d1.transfers - d0.transfers) != (s1.transfers - s0.transfers)) ||
+        ((d1.bytes - d0.bytes) != (s1.bytes - s0.bytes)) ||
+        ((d1.drdy_reads - d0.drdy_reads) != (s1.drdy_reads - s0.drdy_reads)))
+    {
+        pass = 0;
+    }
+    total = t1 - t0;
+    
+    /* output */
+    printf("%s    {\n", (first != 0) ? "" : ",\n");
+    printf("      \"name\": \"%s\",\n", item->name);
+    printf("      \"calls\": %u,\n", times);
+    printf("      \"transfers_per_call\": %.3f,\n", transfers);
+    printf("      \"bytes_per_call\": %.3f,\n", (double)(s1.bytes - s0.bytes) / calls);
+    printf("      \"config_writes_per_call\": %.3f,\n", (double)(s1.writes - s0.writes) / calls);
+    printf("      \"drdy_reads_per_call\": %.3f,\n", (double)(s1.drdy_reads - s0.drdy_reads) / calls);
+    printf("      \"delay_us_per_call\": %.3f,\n", (double)(s1.delay_ns - s0.delay_ns) / calls / 1000.0);
+    printf("      \"samples_per_call\": %u,\n", item->samples);
+    printf("      \"driver_samples_per_call\": %.3f,\n", (double)(d1.samples - d0.samples) / calls);
+    printf("      \"samples_per_second\": %.1f,\n",
+           (total != 0) ? ((double)item->samples * calls * 1e9 / (double)total) : 0.0);
+    printf("      \"host_samples_per_second\": %.1f,\n",
+           (h1 != h0) ? ((double)item->samples * calls * 1e9 / (double)(h1 - h0)) : 0.0);
+    printf("      \"sim_latency_us\": {\"p50\": %.3f, \"p90\": %.3f, \"p99\": %.3f, \"max\": %.3f},\n",
+           a_percentile(sim, times, 50) / 1000.0, a_percentile(sim, times, 90) / 1000.0,
+           a_percentile(sim, times, 99) / 1000.0, sim[times - 1] / 1000.0);
+    printf("      \"host_latency_ns\": {\"p50\": %llu, \"p90\": %llu, \"p99\": %llu, \"max\": %llu},\n",
+           (unsigned long long)a_percentile(host, times, 50), (unsigned long long)a_percentile(host, times, 90),
+           (unsigned long long)a_percentile(host, times, 99), (unsigned long long)host[times - 1]);
+    printf("      \"budget_transfers_per_call\": %.3f,\n", item->budget_transfers);
+    printf("      \"pass\": %s\n", (pass != 0) ? "true" : "false");
+    printf("    }");
+    
+    return (pass != 0) ? 0 : 6;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 5 param is invalid
+ *            - 6 over the budget
+ * @note      the result is printed as json
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    char short_options[] = "h";
+    struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"times", required_argument, NULL, 1},
+        {"drdy", no_argument, NULL, 2},
+        {"sclk", required_argument, NULL, 3},
+        {NULL, 0, NULL, 0},
+    };
+    uint32_t times = 1000;
+    uint32_t sclk = 1000000;
+    uint8_t drdy = 0;
+    uint8_t res = 0;
+    uint32_t i;
+    uint64_t *host;
+    uint64_t *sim;
+    
+    /* parse */
+    do
+    {
+        c = getopt_long(argc, argv, short_options, long_options, &longindex);
+        switch (c)
+        {
+            case 1 :
+            {
+                times = (uint32_t)atol(optarg);
+                
+                break;
+            }
+            case 2 :
+            {
+                drdy = 1;
+                
+                break;
+            }
+            case 3 :
+            {
+                sclk = (uint32_t)atol(optarg);
+                
+                break;
+            }
+            case -1 :
+            {
+                break;
+            }
+            default :
+            {
+                printf("Usage:\n");
+                printf("  ads1118_bench [--times=<num>] [--sclk=<hz>] [--drdy]\n");
+                printf("\n");
+                printf("Options:\n");
+                printf("      --drdy                             Link the dout/drdy read function.\n");
+                printf("  -h, --help                             Show the help.\n");
+                printf("      --sclk=<hz>                        Set the simulated spi clock.([default: 1000000])\n");
+                printf("      --times=<num>                      Set the calls of every bench.([default: 1000])\n");
+                
+                return (c == 'h') ? 0 : 5;
+            }
+        }
+    } while (c != -1);
+    if ((times == 0) || (sclk == 0))
+    {
+        return 5;
+    }
+    
+    /* init the simulated chip and the driver */
+    ads1118_sim_reset(&g_ads1118_sim);
+    g_ads1118_sim.sclk_hz = sclk;
+    DRIVER_ADS1118_LINK_INIT(&gs_handle, ads1118_handle_t);
+    DRIVER_ADS1118_LINK_SPI_INIT(&gs_handle, ads1118_interface_spi_init);
+    DRIVER_ADS1118_LINK_SPI_DEINIT(&gs_handle, ads1118_interface_spi_deinit);
+    DRIVER_ADS1118_LINK_SPI_TRANSMIT(&gs_handle, ads1118_interface_spi_transmit);
+    DRIVER_ADS1118_LINK_SPI_TRANSMIT_BATCH(&gs_handle, ads1118_interface_spi_transmit_batch);
+    DRIVER_ADS1118_LINK_DELAY_MS(&gs_handle, ads1118_interface_delay_ms);
+    DRIVER_ADS1118_LINK_DELAY_US(&gs_handle, ads1118_interface_delay_us);
+    DRIVER_ADS1118_LINK_GET_TIME_US(&gs_handle, ads1118_interface_get_time_us);
+    DRIVER_ADS1118_LINK_DEBUG_PRINT(&gs_handle, ads1118_interface_debug_print);
+    if (drdy != 0)
+    {
+        DRIVER_ADS1118_LINK_DRDY_READ(&gs_handle, a_drdy_read);
+    }
+    if (ads1118_init(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    
+    /* init the bus chips, every chip has its own cs */
+    for (i = 0; i < BENCH_BUS_DEVICE; i++)
+    {
+        ads1118_sim_reset(&gs_chip[i]);
+        gs_chip[i].sclk_hz = sclk;
+        DRIVER_ADS1118_LINK_INIT(&gs_bus_handle[i], ads1118_handle_t);
+        DRIVER_ADS1118_LINK_SPI_INIT_CTX(&gs_bus_handle[i], ads1118_interface_spi_init_ctx);
+        DRIVER_ADS1118_LINK_SPI_DEINIT_CTX(&gs_bus_handle[i], ads1118_interface_spi_deinit_ctx);
+        DRIVER_ADS1118_LINK_SPI_TRANSMIT_CTX(&gs_bus_handle[i], ads1118_interface_spi_transmit_ctx);
+        DRIVER_ADS1118_LINK_USER(&gs_bus_handle[i], &gs_chip[i]);
+        DRIVER_ADS1118_LINK_DELAY_MS(&gs_bus_handle[i], ads1118_interface_delay_ms);
+        DRIVER_ADS1118_LINK_DELAY_US(&gs_bus_handle[i], ads1118_interface_delay_us);
+        DRIVER_ADS1118_LINK_GET_TIME_US(&gs_bus_handle[i], ads1118_interface_get_time_us);
+        DRIVER_ADS1118_LINK_DEBUG_PRINT(&gs_bus_handle[i], ads1118_interface_debug_print);
+        if (drdy != 0)
+        {
+            DRIVER_ADS1118_LINK_DRDY_READ_CTX(&gs_bus_handle[i], a_drdy_read_ctx);
+        }
+        if (ads1118_init(&gs_bus_handle[i]) != 0)
+        {
+            return 1;
+        }
+        gs_device[i].handle = &gs_bus_handle[i];
+        gs_device[i].slot = gs_slot;
+        gs_device[i].slot_len = 4;
+    }
+    host = (uint64_t *)malloc(sizeof(uint64_t) * times);
+    sim = (uint64_t *)malloc(sizeof(uint64_t) * times);
+    if ((host == NULL) || (sim == NULL))
+    {
+        free(host);
+        free(sim);
+        (void)ads1118_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* run all items */
+    printf("{\n");
+    printf("  \"driver\": \"ads1118\",\n");
+    printf("  \"sclk_hz\": %u,\n", sclk);
+    printf("  \"drdy\": %s,\n", (drdy != 0) ? "true" : "false");
+    printf("  \"results\": [\n");
+    for (i = 0; i < sizeof(gs_item) / sizeof(gs_item[0]); i++)
+    {
+        uint8_t r;
+        
+        r = a_bench_run(&gs_item[i], times, host, sim, (i == 0) ? 1 : 0);
+        if (r == 1)
+        {
+            res = 1;
+            
+            break;
+        }
+        else if ((r != 0) && (res == 0))
+        {
+            res = r;
+        }
+    }
+    printf("\n  ]\n");
+    printf("}\n");
+    
+    free(host);
+    free(sim);
+    for (i = 0; i < BENCH_BUS_DEVICE; i++)
+    {
+        (void)ads1118_deinit(&gs_bus_handle[i]);
+    }
+    (void)ads1118_deinit(&gs_handle);
+    
+    return res;
+}
@@ -0,0 +1,360 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      lut.c
+ * @brief     thermocouple lookup table generator source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1118.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+/**
+ * @brief lookup table definition
+ */
+#define LUT_TYPE            5             /**< thermocouple types */
+#define LUT_STEP            256           /**< codes of 1/2048 mV between two points */
+#define LUT_OFFSET          270.0         /**< temperature offset of the table in C */
+#define LUT_ERROR_MDEG      250           /**< error spec of the table in 0.001C */
+
+/**
+ * @brief type name definition
+ */
+static const char *const gs_type_name[LUT_TYPE] = {"k", "j", "t", "e", "n"};
+
+/**
+ * @brief     get the temperature limits of a type
+ * @param[in] type thermocouple type
+ * @param[in] *lo pointer to a min temperature buffer
+ * @param[in] *hi pointer to a max temperature buffer
+ * @note      the limits are the clamp values of ads1118_thermocouple_mv_to_deg
+ */
+static void a_lut_limit(uint8_t type, float *lo, float *hi)
+{
+    (void)ads1118_thermocouple_mv_to_deg((ads1118_thermocouple_type_t)type, -1000.0f, lo);
+    (void)ads1118_thermocouple_mv_to_deg((ads1118_thermocouple_type_t)type, 1000.0f, hi);
+}
+
+/**
+ * @brief     invert the forward polynomial
+ * @param[in] type thermocouple type
+ * @param[in] mv emf in mV
+ * @return    temperature in C
+ * @note      bisection of ads1118_thermocouple_deg_to_mv, mv must be in the range of the type
+ */
+static double a_lut_exact(uint8_t type, double mv)
+{
+    float lo;
+    float hi;
+    float mid;
+    float e;
+    uint8_t i;
+    
+    a_lut_limit(type, &lo, &hi);
+    for (i = 0; i < 40; i++)
+    {
+        mid = (lo + hi) * 0.5f;
+        (void)ads1118_thermocouple_deg_to_mv((ads1118_thermocouple_type_t)type, mid, &e);
+        if ((double)e < mv)
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    
+    return ((double)lo + (double)hi) * 0.5;
+}
+
+/**
+ * @brief      get the code range of a type
+ * @param[in]  type thermocouple type
+ * @param[out] *lo pointer to a min code buffer
+ * @param[out] *hi pointer to a max code buffer
+ * @param[out] *base pointer to a first point code buffer
+ * @return     number of points
+ * @note       codes are in 1/2048 mV
+ */
+static uint32_t a_lut_range(uint8_t type, int32_t *lo, int32_t *hi, int32_t *base)
+{
+    float dlo;
+    float dhi;
+    float mlo;
+    float mhi;
+    
+    a_lut_limit(type, &dlo, &dhi);
+    (void)ads1118_thermocouple_deg_to_mv((ads1118_thermocouple_type_t)type, dlo, &mlo);
+    (void)ads1118_thermocouple_deg_to_mv((ads1118_thermocouple_type_t)type, dhi, &mhi);
+    *lo = (int32_t)ceil((double)mlo * 2048.0);
+    *hi = (int32_t)floor((double)mhi * 2048.0);
+    *base = (int32_t)floor((double)*lo / LUT_STEP) * LUT_STEP;
+    
+    return (uint32_t)((*hi - *base) / LUT_STEP) + 2;
+}
+
+/**
+ * @brief      build the table of a type
+ * @param[in]  type thermocouple type
+ * @param[out] *point pointer to a point buffer
+ * @return     number of points
+ * @note       the first and the last point are outside of the range, they are put on the line
+ *             through the next point and the exact temperature at the range limit
+ */
+static uint32_t a_lut_build(uint8_t type, uint16_t *point)
+{
+    double t[1024];
+    int32_t lo;
+    int32_t hi;
+    int32_t base;
+    int32_t x;
+    uint32_t n;
+    uint32_t i;
+    
+    n = a_lut_range(type, &lo, &hi, &base);
+    for (i = 1; i < n - 1; i++)
+    {
+        t[i] = a_lut_exact(type, (double)(base + (int32_t)i * LUT_STEP) / 2048.0);
+    }
+    
+    /* first point */
+    if (lo == base)
+    {
+        t[0] = a_lut_exact(type, (double)lo / 2048.0);
+    }
+    else
+    {
+        t[0] = t[1] + (a_lut_exact(type, (double)lo / 2048.0) - t[1]) * LUT_STEP / (double)(base + LUT_STEP - lo);
+    }
+    
+    /* last point */
+    x = base + (int32_t)(n - 2) * LUT_STEP;
+    if (hi > x)
+    {
+        t[n - 1] = t[n - 2] + (a_lut_exact(type, (double)hi / 2048.0) - t[n - 2]) * LUT_STEP / (double)(hi - x);
+    }
+    else
+    {
+        t[n - 1] = 2.0 * t[n - 2] - t[n - 3];
+    }
+    
+    for (i = 0; i < n; i++)
+    {
+        point[i] = (uint16_t)floor((t[i] + LUT_OFFSET) * 16.0 + 0.5);
+    }
+    
+    return n;
+}
+
+/**
+ * @brief  print the c source of the tables
+ * @return status code
+ *         - 0 success
+ * @note   the output replaces the block between the ads1118_lut markers of driver_ads1118.c
+ */
+static uint8_t a_lut_print(void)
+{
+    static uint16_t point[LUT_TYPE][1024];
+    uint32_t num[LUT_TYPE];
+    int32_t lo[LUT_TYPE];
+    int32_t hi[LUT_TYPE];
+    int32_t base[LUT_TYPE];
+    uint32_t total = 0;
+    uint32_t start[LUT_TYPE];
+    uint32_t i;
+    uint8_t type;
+    
+    for (type = 0; type < LUT_TYPE; type++)
+    {
+        num[type] = a_lut_build(type, point[type]);
+        (void)a_lut_range(type, &lo[type], &hi[type], &base[type]);
+        start[type] = total;
+        total += num[type];
+    }
+    
+    printf("/* ads1118_lut begin */\n");
+    printf("/**\n");
+    printf(" * @brief thermocouple lookup table definition\n");
+    printf(" * @note  generated by project/simulator/src/lut.c from the nist polynomials, do not edit,\n");
+    printf(" *        points are (temperature + 270C) * 16 at every 0.125mV from the base code of the type,\n");
+    printf(" *        codes are emf in 1/2048 mV\n");
+    printf(" */\n");
+    printf("static const uint16_t gs_tc_lut[%u] =\n{\n", (unsigned int)total);
+    for (type = 0; type < LUT_TYPE; type++)
+    {
+        printf("    /* %s type */\n", gs_type_name[type]);
+        for (i = 0; i < num[type]; i++)
+        {
+            printf("%s%5u,%s", (i % 12) == 0 ? "    " : "", (unsigned int)point[type][i],
+                   ((i % 12) == 11 || i == num[type] - 1) ? "\n" : " ");
+        }
+    }
+    printf("};\n");
+    printf("static const uint16_t gs_tc_lut_start[5] = {%u, %u, %u, %u, %u};\n",
+           (unsigned int)start[0], (unsigned int)start[1], (unsigned int)start[2],
+           (unsigned int)start[3], (unsigned int)start[4]);
+    printf("static const int32_t gs_tc_lut_base[5] = {%d, %d, %d, %d, %d};\n",
+           (int)base[0], (int)base[1], (int)base[2], (int)base[3], (int)base[4]);
+    printf("static const int32_t gs_tc_lut_min[5] = {%d, %d, %d, %d, %d};\n",
+           (int)lo[0], (int)lo[1], (int)lo[2], (int)lo[3], (int)lo[4]);
+    printf("static const int32_t gs_tc_lut_max[5] = {%d, %d, %d, %d, %d};\n",
+           (int)hi[0], (int)hi[1], (int)hi[2], (int)hi[3], (int)hi[4]);
+    printf("/* ads1118_lut end */\n");
+    
+    return 0;
+}
+
+/**
+ * @brief     check one type against the exact inverse
+ * @param[in] type thermocouple type
+ * @param[in] range adc range
+ * @param[in] cj cold junction temperature
+ * @param[in] *lut_err pointer to a table error buffer
+ * @param[in] *poly_err pointer to a polynomial error buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      every raw code of the range inside the table is converted
+ */
+static uint8_t a_lut_check_type(uint8_t type, ads1118_range_t range, float cj, double *lut_err, double *poly_err)
+{
+    static const int32_t scale[6] = {384, 256, 128, 64, 32, 16};
+    ads1118_thermocouple_t tc;
+    int32_t lo;
+    int32_t hi;
+    int32_t base;
+    int32_t raw;
+    int32_t q;
+    int16_t r;
+    int32_t mdeg;
+    float deg;
+    double exact;
+    double e;
+    
+    if (ads1118_thermocouple_init(&tc, (ads1118_thermocouple_type_t)type, ADS1118_CHANNEL_AIN0_AIN1,
+                                  range, ADS1118_RATE_128SPS, 1) != 0)
+    {
+        return 1;
+    }
+    if (ads1118_thermocouple_set_cold_junction(&tc, cj) != 0)
+    {
+        return 1;
+    }
+    (void)a_lut_range(type, &lo, &hi, &base);
+    for (raw = -32768; raw < 32768; raw++)
+    {
+        q = raw * scale[range] + tc.cj_code;
+        if ((q < lo) || (q > hi))
+        {
+            continue;
+        }
+        r = (int16_t)raw;
+        if (ads1118_thermocouple_raw_to_mdeg_n(&tc, &r, &mdeg, 1) != 0)
+        {
+            return 1;
+        }
+        exact = a_lut_exact(type, (double)q / 2048.0);
+        e = fabs((double)mdeg * 0.001 - exact);
+        *lut_err = (e > *lut_err) ? e : *lut_err;
+        (void)ads1118_thermocouple_mv_to_deg((ads1118_thermocouple_type_t)type, (float)q / 2048.0f, &deg);
+        e = fabs((double)deg - exact);
+        *poly_err = (e > *poly_err) ? e : *poly_err;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  check the compiled tables
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   none
+ */
+static uint8_t a_lut_check(void)
+{
+    uint8_t type;
+    uint8_t res = 0;
+    
+    for (type = 0; type < LUT_TYPE; type++)
+    {
+        double lut_err = 0.0;
+        double poly_err = 0.0;
+    
+        /* every code of the smallest range with a 0C cold junction, the larger ranges with a 25C one */
+        if ((a_lut_check_type(type, ADS1118_RANGE_0P256V, 0.0f, &lut_err, &poly_err) != 0) ||
+            (a_lut_check_type(type, ADS1118_RANGE_0P512V, 25.0f, &lut_err, &poly_err) != 0) ||
+            (a_lut_check_type(type, ADS1118_RANGE_6P144V, 25.0f, &lut_err, &poly_err) != 0))
+        {
+            printf("ads1118_lut: %s type check failed.\n", gs_type_name[type]);
+    
+            return 1;
+        }
+        printf("ads1118_lut: %s type table error %0.3fC polynomial error %0.3fC %s.\n", gs_type_name[type],
+               lut_err, poly_err, (lut_err * 1000.0 <= LUT_ERROR_MDEG) ? "ok" : "over the spec");
+        if (lut_err * 1000.0 > LUT_ERROR_MDEG)
+        {
+            res = 1;
+        }
+    }
+    
+    return res;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ *            - 5 param is invalid
+ * @note      without param the c source of the tables is printed,
+ *            --check converts every code with the compiled tables and fails over the error spec
+ */
+int main(int argc, char **argv)
+{
+    if (argc == 1)
+    {
+        return a_lut_print();
+    }
+    if ((argc == 2) && (strcmp(argv[1], "--check") == 0))
+    {
+        return a_lut_check();
+    }
+    printf("Usage:\n");
+    printf("  ads1118_lut [--check]\n");
+    
+    return 5;
+}
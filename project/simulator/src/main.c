@@ -0,0 +1,519 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      main.c
+ * @brief     main source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1118_bus_test.h"
+#include "driver_ads1118_mutichannel_test.h"
+#include "driver_ads1118_read_test.h"
+#include "driver_ads1118_register_test.h"
+#include "driver_ads1118_basic.h"
+#include "driver_ads1118_shot.h"
+#include "ads1118_sim.h"
+#include <getopt.h>
+#include <stdlib.h>
+
+/**
+ * @brief global var definition
+ */
+volatile uint8_t g_flag;            /**< interrupt flag */
+
+/**
+ * @brief simulated bus definition
+ */
+#define SIM_BUS_DEVICE        4                 /**< simulated chips on the bus */
+static ads1118_sim_t gs_chip[SIM_BUS_DEVICE];  /**< simulated chips */
+
+/**
+ * @brief     ads1118 full function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 5 param is invalid
+ * @note      none
+ */
+uint8_t ads1118(uint8_t argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    char short_options[] = "hie:t:";
+    struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"information", no_argument, NULL, 'i'},
+        {"example", required_argument, NULL, 'e'},
+        {"test", required_argument, NULL, 't'},
+        {"channel", required_argument, NULL, 1},
+        {"times", required_argument, NULL, 2},
+        {NULL, 0, NULL, 0},
+    };
+    char type[33] = "unknown";
+    uint32_t times = 3;
+    ads1118_channel_t channel = ADS1118_CHANNEL_AIN0_GND;
+
+    /* if no params */
+    if (argc == 1)
+    {
+        /* goto the help */
+        goto help;
+    }
+
+    /* init 0 */
+    optind = 0;
+
+    /* parse */
+    do
+    {
+        /* parse the args */
+        c = getopt_long(argc, argv, short_options, long_options, &longindex);
+
+        /* judge the result */
+        switch (c)
+        {
+            /* help */
+            case 'h' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "h");
+
+                break;
+            }
+
+            /* information */
+            case 'i' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "i");
+
+                break;
+            }
+
+            /* example */
+            case 'e' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "e_%s", optarg);
+
+                break;
+            }
+
+            /* test */
+            case 't' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "t_%s", optarg);
+
+                break;
+            }
+
+            /* channel */
+            case 1 :
+            {
+                /* set the channel */
+                if (strcmp("AIN0_AIN1", optarg) == 0)
+                {
+                    channel = ADS1118_CHANNEL_AIN0_AIN1;
+                }
+                else if (strcmp("AIN0_AIN3", optarg) == 0)
+                {
+                    channel = ADS1118_CHANNEL_AIN0_AIN3;
+                }
+                else if (strcmp("AIN1_AIN3", optarg) == 0)
+                {
+                    channel = ADS1118_CHANNEL_AIN1_AIN3;
+                }
+                else if (strcmp("AIN2_AIN3", optarg) == 0)
+                {
+                    channel = ADS1118_CHANNEL_AIN2_AIN3;
+                }
+                else if (strcmp("AIN0_GND", optarg) == 0)
+                {
+                    channel = ADS1118_CHANNEL_AIN0_GND;
+                }
+                else if (strcmp("AIN1_GND", optarg) == 0)
+                {
+                    channel = ADS1118_CHANNEL_AIN1_GND;
+                }
+                else if (strcmp("AIN2_GND", optarg) == 0)
+                {
+                    channel = ADS1118_CHANNEL_AIN2_GND;
+                }
+                else if (strcmp("AIN3_GND", optarg) == 0)
+                {
+                    channel = ADS1118_CHANNEL_AIN3_GND;
+                }
+                else
+                {
+                    return 5;
+                }
+
+                break;
+            }
+
+            /* running times */
+            case 2 :
+            {
+                /* set the times */
+                times = atol(optarg);
+
+                break;
+            }
+
+            /* the end */
+            case -1 :
+            {
+                break;
+            }
+
+            /* others */
+            default :
+            {
+                return 5;
+            }
+        }
+    } while (c != -1);
+
+    /* run the function */
+    if (strcmp("t_reg", type) == 0)
+    {
+        /* run the reg test */
+        if (ads1118_register_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_read", type) == 0)
+    {
+        /* run the read test */
+        if (ads1118_read_test(times) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_muti", type) == 0)
+    {
+        /* run the multichannel test */
+        if (ads1118_multichannel_test(channel, times) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_bus", type) == 0)
+    {
+        void *user[SIM_BUS_DEVICE];
+        ads1118_sim_input_t in;
+        uint8_t i;
+        
+        /* every chip gets its own AIN1_GND level */
+        for (i = 0; i < SIM_BUS_DEVICE; i++)
+        {
+            gs_chip[i] = g_ads1118_sim;
+            memset(&in, 0, sizeof(in));
+            in.offset = 0.5 + 0.25 * i;
+            (void)ads1118_sim_set_input(&gs_chip[i], ADS1118_CHANNEL_AIN1_GND, &in);
+            user[i] = &gs_chip[i];
+        }
+        
+        /* run the bus test */
+        if (ads1118_bus_test(user, SIM_BUS_DEVICE, times) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("e_read", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        float s;
+
+        /* basic init */
+        res = ads1118_basic_init(ADS1118_MODE_ADC, channel);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: basic init failed.\n");
+
+            return 1;
+        }
+        for (i = 0; i < times; i++)
+        {
+            /* read the data */
+            res = ads1118_basic_read((float *)&s);
+            if (res != 0)
+            {
+                ads1118_interface_debug_print("ads1118: basic read failed.\n");
+                (void)ads1118_basic_deinit();
+
+                return 1;
+            }
+            ads1118_interface_debug_print("ads1118: %d/%d.\n", i + 1, times);
+            ads1118_interface_debug_print("ads1118: adc is %0.4fV.\n", s);
+            ads1118_interface_delay_ms(1000);
+        }
+        (void)ads1118_basic_deinit();
+
+        return 0;
+    }
+    else if (strcmp("e_shot", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        float s;
+
+        /* shot init */
+        res = ads1118_shot_init(ADS1118_MODE_ADC, channel);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: shot init failed.\n");
+
+            return 1;
+        }
+        for (i = 0; i < times; i++)
+        {
+            /* read the data */
+            res = ads1118_shot_read((float *)&s);
+            if (res != 0)
+            {
+                ads1118_interface_debug_print("ads1118: shot read failed.\n");
+                (void)ads1118_shot_deinit();
+
+                return 1;
+            }
+            ads1118_interface_debug_print("ads1118: %d/%d.\n", i + 1, times);
+            ads1118_interface_debug_print("ads1118: adc is %0.4fV.\n", s);
+            ads1118_interface_delay_ms(1000);
+        }
+        (void)ads1118_shot_deinit();
+
+        return 0;
+    }
+    else if (strcmp("e_temperature", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        float s;
+
+        /* shot init */
+        res = ads1118_shot_init(ADS1118_MODE_TEMPERATURE, channel);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: shot init failed.\n");
+
+            return 1;
+        }
+        for (i = 0; i < times; i++)
+        {
+            /* read the data */
+            res = ads1118_shot_read_temperature((float *)&s);
+            if (res != 0)
+            {
+                ads1118_interface_debug_print("ads1118: shot read failed.\n");
+                (void)ads1118_shot_deinit();
+
+                return 1;
+            }
+            ads1118_interface_debug_print("ads1118: %d/%d.\n", i + 1, times);
+            ads1118_interface_debug_print("ads1118: temperature is %0.2fC.\n", s);
+            ads1118_interface_delay_ms(1000);
+        }
+        (void)ads1118_shot_deinit();
+
+        return 0;
+    }
+    else if (strcmp("h", type) == 0)
+    {
+        help:
+        ads1118_interface_debug_print("Usage:\n");
+        ads1118_interface_debug_print("  ads1118 (-i | --information)\n");
+        ads1118_interface_debug_print("  ads1118 (-h | --help)\n");
+        ads1118_interface_debug_print("  ads1118 (-t reg | --test=reg)\n");
+        ads1118_interface_debug_print("  ads1118 (-t read | --test=read) [--times=<num>]\n");
+        ads1118_interface_debug_print("  ads1118 (-t muti | --test=muti) [--times=<num>]\n");
+        ads1118_interface_debug_print("          [--channel=<AIN0_AIN1 | AIN0_AIN3 | AIN1_AIN3 | AIN2_AIN3 | AIN0_GND | AIN1_GND | AIN2_GND | AIN3_GND>]\n");
+        ads1118_interface_debug_print("  ads1118 (-t bus | --test=bus) [--times=<num>]\n");
+        ads1118_interface_debug_print("  ads1118 (-e read | --example=read) [--times=<num>]\n");
+        ads1118_interface_debug_print("          [--channel=<AIN0_AIN1 | AIN0_AIN3 | AIN1_AIN3 | AIN2_AIN3 | AIN0_GND | AIN1_GND | AIN2_GND | AIN3_GND>]\n");
+        ads1118_interface_debug_print("  ads1118 (-e shot | --example=shot) [--times=<num>]\n");
+        ads1118_interface_debug_print("          [--channel=<AIN0_AIN1 | AIN0_AIN3 | AIN1_AIN3 | AIN2_AIN3 | AIN0_GND | AIN1_GND | AIN2_GND | AIN3_GND>]\n");
+        ads1118_interface_debug_print("  ads1118 (-e temperature | --example=temperature) [--times=<num>]\n");
+        ads1118_interface_debug_print("\n");
+        ads1118_interface_debug_print("Options:\n");
+        ads1118_interface_debug_print("      --channel=<AIN0_AIN1 | AIN0_AIN3 | AIN1_AIN3 | AIN2_AIN3 | AIN0_GND | AIN1_GND | AIN2_GND | AIN3_GND>\n");
+        ads1118_interface_debug_print("                                         Set the ADC channel.([default: AIN0_GND])\n");
+        ads1118_interface_debug_print("  -e <read | shot | temperature>, --example=<read | shot | temperature>\n");
+        ads1118_interface_debug_print("                                         Run the driver example.\n");
+        ads1118_interface_debug_print("  -h, --help                             Show the help.\n");
+        ads1118_interface_debug_print("  -i, --information                      Show the chip information.\n");
+        ads1118_interface_debug_print("  -t <reg | read | muti | bus>, --test=<reg | read | muti | bus>.\n");
+        ads1118_interface_debug_print("                                         Run the driver test.\n");
+        ads1118_interface_debug_print("      --times=<num>                      Set the running times.([default: 3])\n");
+
+        return 0;
+    }
+    else if (strcmp("i", type) == 0)
+    {
+        ads1118_info_t info;
+
+        /* print ads1118 info */
+        ads1118_info(&info);
+        ads1118_interface_debug_print("ads1118: chip is %s.\n", info.chip_name);
+        ads1118_interface_debug_print("ads1118: manufacturer is %s.\n", info.manufacturer_name);
+        ads1118_interface_debug_print("ads1118: interface is %s.\n", info.interface);
+        ads1118_interface_debug_print("ads1118: driver version is %d.%d.\n", info.driver_version / 1000, (info.driver_version % 1000) / 100);
+        ads1118_interface_debug_print("ads1118: min supply voltage is %0.1fV.\n", info.supply_voltage_min_v);
+        ads1118_interface_debug_print("ads1118: max supply voltage is %0.1fV.\n", info.supply_voltage_max_v);
+        ads1118_interface_debug_print("ads1118: max current is %0.2fmA.\n", info.max_current_ma);
+        ads1118_interface_debug_print("ads1118: max temperature is %0.1fC.\n", info.temperature_max);
+        ads1118_interface_debug_print("ads1118: min temperature is %0.1fC.\n", info.temperature_min);
+
+        return 0;
+    }
+    else
+    {
+        return 5;
+    }
+}
+
+/**
+ * @brief     set the simulated chip inputs
+ * @note      the single ended inputs are a sine, two dc levels and a ramp
+ */
+static void a_sim_init(void)
+{
+    ads1118_sim_input_t in;
+    
+    ads1118_sim_reset(&g_ads1118_sim);
+    
+    /* AIN0_AIN1 */
+    memset(&in, 0, sizeof(in));
+    in.wave = ADS1118_SIM_WAVE_SINE;
+    in.offset = 0.85;
+    in.amplitude = 0.1;
+    in.freq = 1.0;
+    (void)ads1118_sim_set_input(&g_ads1118_sim, ADS1118_CHANNEL_AIN0_AIN1, &in);
+    
+    /* AIN0_AIN3 */
+    in.offset = 1.65;
+    (void)ads1118_sim_set_input(&g_ads1118_sim, ADS1118_CHANNEL_AIN0_AIN3, &in);
+    
+    /* AIN1_AIN3 */
+    memset(&in, 0, sizeof(in));
+    in.offset = 0.8;
+    (void)ads1118_sim_set_input(&g_ads1118_sim, ADS1118_CHANNEL_AIN1_AIN3, &in);
+    
+    /* AIN2_AIN3, k type thermocouple at 100C with the cold junction at 25C */
+    in.offset = 0.003096;
+    (void)ads1118_sim_set_input(&g_ads1118_sim, ADS1118_CHANNEL_AIN2_AIN3, &in);
+    
+    /* AIN0_GND */
+    in.wave = ADS1118_SIM_WAVE_SINE;
+    in.offset = 1.65;
+    in.amplitude = 0.1;
+    in.freq = 1.0;
+    in.noise = 0.0005;
+    (void)ads1118_sim_set_input(&g_ads1118_sim, ADS1118_CHANNEL_AIN0_GND, &in);
+    
+    /* AIN1_GND */
+    memset(&in, 0, sizeof(in));
+    in.offset = 0.8;
+    (void)ads1118_sim_set_input(&g_ads1118_sim, ADS1118_CHANNEL_AIN1_GND, &in);
+    
+    /* AIN2_GND */
+    in.offset = 2.5;
+    (void)ads1118_sim_set_input(&g_ads1118_sim, ADS1118_CHANNEL_AIN2_GND, &in);
+    
+    /* AIN3_GND */
+    in.wave = ADS1118_SIM_WAVE_RAMP;
+    in.offset = 1.0;
+    in.amplitude = 1.0;
+    in.freq = 0.5;
+    (void)ads1118_sim_set_input(&g_ads1118_sim, ADS1118_CHANNEL_AIN3_GND, &in);
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 5 param is invalid
+ * @note      none
+ */
+int main(int argc, char **argv)
+{
+    uint8_t res;
+    
+    a_sim_init();
+    res = ads1118((uint8_t)argc, argv);
+    if (res == 0)
+    {
+        /* run success */
+    }
+    else if (res == 1)
+    {
+        ads1118_interface_debug_print("ads1118: run failed.\n");
+    }
+    else if (res == 5)
+    {
+        ads1118_interface_debug_print("ads1118: param is invalid.\n");
+    }
+    else
+    {
+        ads1118_interface_debug_print("ads1118: unknown status code.\n");
+    }
+
+    return res;
+}
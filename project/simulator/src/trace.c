@@ -0,0 +1,219 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      trace.c
+ * @brief     trace decoder source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * @brief api name definition
+ */
+static const char *const gs_api_name[] =
+{
+    "init", "deinit", "set_channel", "set_range", "set_rate", "set_mode",
+    "set_dout_pull_up", "sync_config", "verify_config", "batch_end", "single_read",
+    "convert_and_fetch", "scan", "continuous_read", "start_continuous_read",
+    "stop_continuous_read", "transmit", "single_async", "capture_offset",
+    "thermocouple_read",
+};
+
+/**
+ * @brief type name definition
+ */
+static const char *const gs_type_name[] =
+{
+    "read_config", "read_data", "write", "write_read", "transmit", "batch",
+};
+
+#define API_NUM     (sizeof(gs_api_name) / sizeof(gs_api_name[0]))      /**< api number */
+#define TYPE_NUM    (sizeof(gs_type_name) / sizeof(gs_type_name[0]))    /**< type number */
+
+/**
+ * @brief bus time summary definition
+ */
+static uint64_t gs_api_us[API_NUM + 1];          /**< bus time of every api */
+static uint32_t gs_api_frames[API_NUM + 1];      /**< frames of every api */
+static uint64_t gs_type_us[TYPE_NUM + 1];        /**< bus time of every type */
+static uint32_t gs_type_frames[TYPE_NUM + 1];    /**< frames of every type */
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 no trace line
+ *            - 5 param is invalid
+ * @note      the "ads1118: trace" lines of ads1118_trace_dump are read from a log file or stdin,
+ *            other lines are skipped
+ */
+int main(int argc, char **argv)
+{
+    FILE *f;
+    char line[512];
+    uint32_t n = 0;
+    uint32_t lost = 0;
+    uint32_t errors = 0;
+    uint64_t first = 0;
+    uint64_t last_end = 0;
+    uint64_t busy = 0;
+    uint64_t span = 0;
+    unsigned long prev_seq = 0;
+    uint32_t i;
+    
+    if (argc > 2)
+    {
+        printf("Usage:\n");
+        printf("  ads1118_trace [<log file>]\n");
+        
+        return 5;
+    }
+    if (argc == 2)
+    {
+        f = fopen(argv[1], "r");
+        if (f == NULL)
+        {
+            printf("ads1118_trace: open %s failed.\n", argv[1]);
+            
+            return 5;
+        }
+    }
+    else
+    {
+        f = stdin;
+    }
+    
+    printf("%10s %10s %8s %6s  %-22s %-12s %4s %3s  %-8s %-8s\n",
+           "time(us)", "gap(us)", "dur(us)", "seq", "api", "type", "len", "res", "tx", "rx");
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        const char *p;
+        unsigned long seq;
+        unsigned long ts_hi;
+        unsigned long ts_lo;
+        unsigned long dur;
+        unsigned int type;
+        unsigned int api;
+        unsigned int res;
+        unsigned int len;
+        char tx[16];
+        char rx[16];
+        uint64_t ts;
+        uint64_t gap;
+        
+        /* find a trace line */
+        p = strstr(line, "ads1118: trace ");
+        if (p == NULL)
+        {
+            continue;
+        }
+        if (sscanf(p + strlen("ads1118: trace "), "%lu %8lx%8lx %lu %u %u %u %u %8s %8s",
+                   &seq, &ts_hi, &ts_lo, &dur, &type, &api, &res, &len, tx, rx) != 10)
+        {
+            continue;
+        }
+        ts = ((uint64_t)ts_hi << 32) | (uint64_t)ts_lo;
+        
+        /* timeline */
+        if (n == 0)
+        {
+            first = ts;
+            last_end = ts;
+        }
+        else if (seq != prev_seq + 1)
+        {
+            lost += (uint32_t)(seq - prev_seq - 1);
+            printf("%10s %10s %8s %6s  <%lu entries lost>\n", "", "", "", "", seq - prev_seq - 1);
+        }
+        gap = (ts > last_end) ? (ts - last_end) : 0;
+        printf("%10llu %10llu %8lu %6lu  %-22s %-12s %4u %3u  %-8s %-8s\n",
+               (unsigned long long)(ts - first), (unsigned long long)gap, dur, seq,
+               (api < API_NUM) ? gs_api_name[api] : "unknown",
+               (type < TYPE_NUM) ? gs_type_name[type] : "unknown",
+               len, res, tx, rx);
+        
+        /* summary */
+        busy += dur;
+        gs_api_us[(api < API_NUM) ? api : API_NUM] += dur;
+        gs_api_frames[(api < API_NUM) ? api : API_NUM]++;
+        gs_type_us[(type < TYPE_NUM) ? type : TYPE_NUM] += dur;
+        gs_type_frames[(type < TYPE_NUM) ? type : TYPE_NUM]++;
+        if (res != 0)
+        {
+            errors++;
+        }
+        last_end = ts + dur;
+        span = last_end - first;
+        prev_seq = seq;
+        n++;
+    }
+    if (f != stdin)
+    {
+        (void)fclose(f);
+    }
+    if (n == 0)
+    {
+        printf("ads1118_trace: no trace line.\n");
+        
+        return 1;
+    }
+    
+    /* print the summary */
+    printf("\n");
+    printf("entries %u, lost %u, failed %u.\n", n, lost, errors);
+    printf("span %llu us, bus busy %llu us (%.1f%%).\n", (unsigned long long)span, (unsigned long long)busy,
+           (span != 0) ? (100.0 * (double)busy / (double)span) : 0.0);
+    printf("\n%-22s %8s %12s\n", "api", "frames", "bus(us)");
+    for (i = 0; i <= API_NUM; i++)
+    {
+        if (gs_api_frames[i] != 0)
+        {
+            printf("%-22s %8u %12llu\n", (i < API_NUM) ? gs_api_name[i] : "unknown",
+                   gs_api_frames[i], (unsigned long long)gs_api_us[i]);
+        }
+    }
+    printf("\n%-22s %8s %12s\n", "type", "frames", "bus(us)");
+    for (i = 0; i <= TYPE_NUM; i++)
+    {
+        if (gs_type_frames[i] != 0)
+        {
+            printf("%-22s %8u %12llu\n", (i < TYPE_NUM) ? gs_type_name[i] : "unknown",
+                   gs_type_frames[i], (unsigned long long)gs_type_us[i]);
+        }
+    }
+    
+    return 0;
+}
@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      stm32f407_driver_ads1118_stream.h
+ * @brief     stm32f407 driver ads1118 stream header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef STM32F407_DRIVER_ADS1118_STREAM_H
+#define STM32F407_DRIVER_ADS1118_STREAM_H
+
+#include "driver_ads1118_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup stm32f407_ads1118_stream stm32f407 ads1118 stream function
+ * @brief    stm32f407 ads1118 stream modules
+ * @{
+ */
+
+/**
+ * @brief     start the drdy and dma driven stream
+ * @param[in] *handle pointer to an initialized ads1118 handle structure
+ * @param[in] *ring pointer to an initialized ads1118 ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      the chip is set to the continuous mode and cs stays low,
+ *            every falling edge of DOUT/DRDY starts a dma read into one of two buffers,
+ *            the dma irq pushes the sample into the ring and the cpu only pops the ring,
+ *            do not use the handle until ads1118_stream_stop
+ */
+uint8_t ads1118_stream_start(ads1118_handle_t *handle, ads1118_ring_t *ring);
+
+/**
+ * @brief  stop the stream
+ * @return status code
+ *         - 0 success
+ *         - 1 stop failed
+ * @note   the last dma read is finished before cs is released and the chip goes back to the single shot mode
+ */
+uint8_t ads1118_stream_stop(void);
+
+/**
+ * @brief      get the stream counters
+ * @param[out] *frames pointer to a frame number buffer
+ * @param[out] *errors pointer to an error number buffer
+ * @note       frames are the finished dma reads, dropped samples of a full ring are counted by the ring
+ */
+void ads1118_stream_get_count(uint32_t *frames, uint32_t *errors);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -79,6 +79,78 @@ uint8_t ads1118_interface_spi_transmit(uint8_t *tx, uint8_t *rx, uint16_t len)
     return spi_transmit(tx, rx ,len);
 }
 
+/**
+ * @brief     interface spi bus transmit batch
+ * @param[in] *frame pointer to a frame buffer
+ * @param[in] num frame number
+ * @return    status code
+ *            - 0 success
+ *            - 1 transmit failed
+ * @note      the blocking hal driver sends the frames one by one
+ */
+uint8_t ads1118_interface_spi_transmit_batch(ads1118_frame_t *frame, uint16_t num)
+{
+    uint16_t i;
+    
+    for (i = 0; i < num; i++)
+    {
+        if (spi_transmit(frame[i].tx, frame[i].rx, frame[i].len) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     interface spi bus init with a user context
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 spi init failed
+ * @note      only one chip select is wired on this board, so user is not used
+ */
+uint8_t ads1118_interface_spi_init_ctx(void *user)
+{
+    (void)user;
+    
+    return ads1118_interface_spi_init();
+}
+
+/**
+ * @brief     interface spi bus deinit with a user context
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 spi deinit failed
+ * @note      only one chip select is wired on this board, so user is not used
+ */
+uint8_t ads1118_interface_spi_deinit_ctx(void *user)
+{
+    (void)user;
+    
+    return ads1118_interface_spi_deinit();
+}
+
+/**
+ * @brief      interface spi bus transmit with a user context
+ * @param[in]  *user pointer to a user context
+ * @param[in]  *tx pointer to a tx buffer
+ * @param[out] *rx pointer to a rx buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 transmit failed
+ * @note       only one chip select is wired on this board, so user is not used
+ */
+uint8_t ads1118_interface_spi_transmit_ctx(void *user, uint8_t *tx, uint8_t *rx, uint16_t len)
+{
+    (void)user;
+    
+    return ads1118_interface_spi_transmit(tx, rx, len);
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -89,6 +161,63 @@ void ads1118_interface_delay_ms(uint32_t ms)
     delay_ms(ms);
 }
 
+/**
+ * @brief     interface delay us
+ * @param[in] us time
+ * @note      none
+ */
+void ads1118_interface_delay_us(uint32_t us)
+{
+    delay_us(us);
+}
+
+/**
+ * @brief tick extension definition
+ */
+static uint32_t gs_tick_last;        /**< last 32 bit ms tick */
+static uint32_t gs_tick_high;        /**< wraps of the 32 bit ms tick */
+
+/**
+ * @brief  interface get time us
+ * @return monotonic time in us
+ * @note   the hal tick gives the ms and the systick counter gives the us in the ms,
+ *         a systick wrap whose interrupt is still pending adds the missing ms,
+ *         the 32 bit ms tick is extended to 64 bit, so it must be called at least once in 49 days,
+ *         it can be called from an interrupt
+ */
+uint64_t ads1118_interface_get_time_us(void)
+{
+    uint32_t primask;
+    uint32_t ms;
+    uint32_t val;
+    uint32_t pending;
+    uint64_t tick;
+    
+    /* the tick can not change while the interrupts are masked */
+    primask = __get_PRIMASK();
+    __disable_irq();
+    ms = HAL_GetTick();
+    val = SysTick->VAL;
+    
+    /* the counter has reloaded but the tick interrupt has not run yet */
+    pending = ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0) ? 1 : 0;
+    if (pending != 0)
+    {
+        val = SysTick->VAL;
+    }
+    
+    /* extend the ms tick */
+    if (ms < gs_tick_last)
+    {
+        gs_tick_high++;
+    }
+    gs_tick_last = ms;
+    tick = (((uint64_t)gs_tick_high << 32) | ms) + pending;
+    __set_PRIMASK(primask);
+    
+    return tick * 1000 + (SysTick->LOAD - val) / (SystemCoreClock / 1000000);
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
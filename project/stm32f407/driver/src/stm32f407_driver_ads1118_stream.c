@@ -0,0 +1,224 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      stm32f407_driver_ads1118_stream.c
+ * @brief     stm32f407 driver ads1118 stream source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "stm32f407_driver_ads1118_stream.h"
+#include "spi.h"
+
+/**
+ * @brief stream var definition
+ */
+static ads1118_handle_t *gs_handle;             /**< ads1118 handle */
+static ads1118_ring_t *gs_ring;                 /**< sample ring */
+static uint8_t gs_tx[2];                        /**< nop frame, the config is not written */
+static uint8_t gs_rx[2][2];                     /**< double rx buffer */
+static uint64_t gs_timestamp[2];                /**< drdy time of every buffer */
+static volatile uint8_t gs_index;               /**< buffer of the running read */
+static volatile uint8_t gs_run;                 /**< stream running flag */
+static volatile uint32_t gs_frames;             /**< finished frames */
+static volatile uint32_t gs_errors;             /**< failed frames */
+static uint8_t gs_channel;                      /**< adc channel */
+static uint8_t gs_range;                        /**< adc range */
+static uint8_t gs_rate;                         /**< adc rate */
+
+/**
+ * @brief     dma finished callback
+ * @param[in] res transmit result
+ * @note      runs in the dma irq
+ */
+static void a_stream_done(uint8_t res)
+{
+    uint8_t i;
+    ads1118_sample_t sample;
+    
+    /* the next read fills the other buffer */
+    i = gs_index;
+    gs_index = i ^ 1;
+    
+    /* wait the next drdy before the sample is pushed */
+    if (gs_run != 0)
+    {
+        spi_drdy_irq_enable(1);
+    }
+    if (res != 0)
+    {
+        gs_errors++;
+        
+        return;
+    }
+    
+    /* push the sample, a full ring counts an overrun */
+    sample.timestamp = gs_timestamp[i];
+    sample.raw = (int16_t)(((uint16_t)gs_rx[i][0] << 8) | gs_rx[i][1]);
+    sample.channel = gs_channel;
+    sample.range = gs_range;
+    sample.rate = gs_rate;
+    sample.device = 0;
+    sample.status = ADS1118_CONTINUOUS_STATUS_FRESH;
+    sample.skipped = 0;
+    (void)ads1118_ring_push(gs_ring, &sample);
+    gs_frames++;
+}
+
+/**
+ * @brief drdy callback
+ * @note  runs in the exti irq
+ */
+static void a_stream_drdy(void)
+{
+    uint8_t i;
+    
+    /* MISO toggles during the read */
+    spi_drdy_irq_enable(0);
+    
+    /* read the data into the free buffer */
+    i = gs_index;
+    gs_timestamp[i] = ads1118_interface_get_time_us();
+    if (spi_transmit_dma(gs_tx, gs_rx[i], 2, a_stream_done) != 0)
+    {
+        gs_errors++;
+        spi_drdy_irq_enable(1);
+    }
+}
+
+/**
+ * @brief     start the drdy and dma driven stream
+ * @param[in] *handle pointer to an initialized ads1118 handle structure
+ * @param[in] *ring pointer to an initialized ads1118 ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      the chip is set to the continuous mode and cs stays low,
+ *            every falling edge of DOUT/DRDY starts a dma read into one of two buffers,
+ *            the dma irq pushes the sample into the ring and the cpu only pops the ring,
+ *            do not use the handle until ads1118_stream_stop
+ */
+uint8_t ads1118_stream_start(ads1118_handle_t *handle, ads1118_ring_t *ring)
+{
+    ads1118_channel_t channel;
+    ads1118_range_t range;
+    ads1118_rate_t rate;
+    
+    if ((handle == NULL) || (ring == NULL) || (gs_run != 0))
+    {
+        return 1;
+    }
+    
+    /* save the sample tag */
+    if ((ads1118_get_channel(handle, &channel) != 0) || (ads1118_get_range(handle, &range) != 0) ||
+        (ads1118_get_rate(handle, &rate) != 0))
+    {
+        return 1;
+    }
+    gs_channel = (uint8_t)channel;
+    gs_range = (uint8_t)range;
+    gs_rate = (uint8_t)rate;
+    
+    /* set the continuous mode */
+    if (ads1118_start_continuous_read(handle) != 0)
+    {
+        return 1;
+    }
+    
+    /* hand the bus to the irq */
+    gs_handle = handle;
+    gs_ring = ring;
+    gs_tx[0] = 0x00;
+    gs_tx[1] = 0x00;
+    gs_index = 0;
+    gs_frames = 0;
+    gs_errors = 0;
+    gs_run = 1;
+    spi_drdy_irq_init(a_stream_drdy);
+    spi_cs_hold(1);
+    spi_drdy_irq_enable(1);
+    
+    return 0;
+}
+
+/**
+ * @brief  stop the stream
+ * @return status code
+ *         - 0 success
+ *         - 1 stop failed
+ * @note   the last dma read is finished before cs is released and the chip goes back to the single shot mode
+ */
+uint8_t ads1118_stream_stop(void)
+{
+    uint32_t start;
+    
+    if (gs_run == 0)
+    {
+        return 1;
+    }
+    
+    /* stop the drdy irq */
+    gs_run = 0;
+    spi_drdy_irq_enable(0);
+    
+    /* wait the last read */
+    start = HAL_GetTick();
+    while (HAL_SPI_GetState(spi_get_handle()) != HAL_SPI_STATE_READY)
+    {
+        if ((HAL_GetTick() - start) > 10)
+        {
+            (void)HAL_SPI_Abort(spi_get_handle());
+            
+            break;
+        }
+    }
+    spi_drdy_irq_enable(0);
+    spi_cs_hold(0);
+    
+    /* set the single shot mode */
+    if (ads1118_stop_continuous_read(gs_handle) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      get the stream counters
+ * @param[out] *frames pointer to a frame number buffer
+ * @param[out] *errors pointer to an error number buffer
+ * @note       frames are the finished dma reads, dropped samples of a full ring are counted by the ring
+ */
+void ads1118_stream_get_count(uint32_t *frames, uint32_t *errors)
+{
+    *frames = gs_frames;
+    *errors = gs_errors;
+}
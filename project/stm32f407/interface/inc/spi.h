@@ -170,10 +170,68 @@ uint8_t spi_write_read(uint8_t *in_buf, uint32_t in_len, uint8_t *out_buf, uint3
  * @return     status code
  *             - 0 success
  *             - 1 transmit failed
- * @note       none
+ * @note       the frame is sent by the full duplex dma and the cpu sleeps until it is finished,
+ *             the buffers must not be in the ccm ram
  */
 uint8_t spi_transmit(uint8_t *tx, uint8_t *rx, uint16_t len);
 
+/**
+ * @brief      spi transmit with the dma in the background
+ * @param[in]  *tx points to a tx buffer
+ * @param[out] *rx points to a rx buffer
+ * @param[in]  len is the length of the data buffer
+ * @param[in]  *callback points to a finished callback
+ * @return     status code
+ *             - 0 success
+ *             - 1 transmit failed
+ * @note       cs is not changed, use spi_cs_hold,
+ *             the callback runs in the dma irq with 0 on success and 1 on error
+ */
+uint8_t spi_transmit_dma(uint8_t *tx, uint8_t *rx, uint16_t len, void (*callback)(uint8_t res));
+
+/**
+ * @brief     spi cs hold
+ * @param[in] enable is a bool value
+ * @note      cs stays low while enable is 1
+ */
+void spi_cs_hold(uint8_t enable);
+
+/**
+ * @brief     spi drdy irq init
+ * @param[in] *callback points to a drdy callback
+ * @note      MISO PA6 is also the DOUT/DRDY pin, the falling edge of EXTI6 is used while cs is low,
+ *            the pin stays in the spi alternate function because its input is still sampled,
+ *            the irq is masked after the init
+ */
+void spi_drdy_irq_init(void (*callback)(void));
+
+/**
+ * @brief     spi drdy irq enable
+ * @param[in] enable is a bool value
+ * @note      the old pending edge is cleared before the irq is unmasked
+ */
+void spi_drdy_irq_enable(uint8_t enable);
+
+/**
+ * @brief  spi get the handle
+ * @return points to a spi handle
+ * @note   none
+ */
+SPI_HandleTypeDef* spi_get_handle(void);
+
+/**
+ * @brief     spi dma irq handler
+ * @param[in] res is the transmit result
+ * @note      none
+ */
+void spi_dma_irq_handler(uint8_t res);
+
+/**
+ * @brief spi drdy irq handler
+ * @note  none
+ */
+void spi_drdy_irq_handler(void);
+
 /**
  * @}
  */
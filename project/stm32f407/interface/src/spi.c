@@ -39,7 +39,12 @@
 /**
  * @brief spi var definition
  */
-SPI_HandleTypeDef g_spi_handle;        /**< spi handle */
+SPI_HandleTypeDef g_spi_handle;                          /**< spi handle */
+DMA_HandleTypeDef g_spi_dma_rx_handle;                   /**< spi dma rx handle */
+DMA_HandleTypeDef g_spi_dma_tx_handle;                   /**< spi dma tx handle */
+volatile uint8_t g_spi_dma_done;                         /**< spi dma done flag, 1 is done and 2 is error */
+void (*volatile g_spi_dma_callback)(uint8_t res);        /**< spi dma finished callback */
+void (*volatile g_spi_drdy_callback)(void);              /**< spi drdy irq callback */
 
 /**
  * @brief  spi cs init
@@ -67,6 +72,63 @@ static uint8_t a_spi_cs_init(void)
     return 0;
 }
 
+/**
+ * @brief  spi dma init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   SPI1_RX is DMA2 stream0 channel3 and SPI1_TX is DMA2 stream3 channel3
+ */
+static uint8_t a_spi_dma_init(void)
+{
+    /* enable dma clock */
+    __HAL_RCC_DMA2_CLK_ENABLE();
+    
+    /* rx dma init */
+    g_spi_dma_rx_handle.Instance = DMA2_Stream0;
+    g_spi_dma_rx_handle.Init.Channel = DMA_CHANNEL_3;
+    g_spi_dma_rx_handle.Init.Direction = DMA_PERIPH_TO_MEMORY;
+    g_spi_dma_rx_handle.Init.PeriphInc = DMA_PINC_DISABLE;
+    g_spi_dma_rx_handle.Init.MemInc = DMA_MINC_ENABLE;
+    g_spi_dma_rx_handle.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    g_spi_dma_rx_handle.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    g_spi_dma_rx_handle.Init.Mode = DMA_NORMAL;
+    g_spi_dma_rx_handle.Init.Priority = DMA_PRIORITY_HIGH;
+    g_spi_dma_rx_handle.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    if (HAL_DMA_Init(&g_spi_dma_rx_handle) != HAL_OK)
+    {
+        return 1;
+    }
+    __HAL_LINKDMA(&g_spi_handle, hdmarx, g_spi_dma_rx_handle);
+    
+    /* tx dma init */
+    g_spi_dma_tx_handle.Instance = DMA2_Stream3;
+    g_spi_dma_tx_handle.Init.Channel = DMA_CHANNEL_3;
+    g_spi_dma_tx_handle.Init.Direction = DMA_MEMORY_TO_PERIPH;
+    g_spi_dma_tx_handle.Init.PeriphInc = DMA_PINC_DISABLE;
+    g_spi_dma_tx_handle.Init.MemInc = DMA_MINC_ENABLE;
+    g_spi_dma_tx_handle.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    g_spi_dma_tx_handle.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    g_spi_dma_tx_handle.Init.Mode = DMA_NORMAL;
+    g_spi_dma_tx_handle.Init.Priority = DMA_PRIORITY_MEDIUM;
+    g_spi_dma_tx_handle.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    if (HAL_DMA_Init(&g_spi_dma_tx_handle) != HAL_OK)
+    {
+        (void)HAL_DMA_DeInit(&g_spi_dma_rx_handle);
+        
+        return 1;
+    }
+    __HAL_LINKDMA(&g_spi_handle, hdmatx, g_spi_dma_tx_handle);
+    
+    /* enable nvic */
+    HAL_NVIC_SetPriority(DMA2_Stream0_IRQn, 1, 0);
+    HAL_NVIC_EnableIRQ(DMA2_Stream0_IRQn);
+    HAL_NVIC_SetPriority(DMA2_Stream3_IRQn, 1, 0);
+    HAL_NVIC_EnableIRQ(DMA2_Stream3_IRQn);
+    
+    return 0;
+}
+
 /**
  * @brief     spi bus init
  * @param[in] mode spi mode
@@ -116,6 +178,16 @@ uint8_t spi_init(spi_mode_t mode)
         return 1;
     }
     
+    /* dma init */
+    g_spi_dma_callback = NULL;
+    g_spi_drdy_callback = NULL;
+    if (a_spi_dma_init() != 0)
+    {
+        (void)HAL_SPI_DeInit(&g_spi_handle);
+        
+        return 1;
+    }
+    
     return a_spi_cs_init();
 }
 
@@ -128,6 +200,16 @@ uint8_t spi_init(spi_mode_t mode)
  */
 uint8_t spi_deinit(void)
 {
+    /* drdy irq deinit */
+    spi_drdy_irq_enable(0);
+    HAL_NVIC_DisableIRQ(EXTI9_5_IRQn);
+    
+    /* dma deinit */
+    HAL_NVIC_DisableIRQ(DMA2_Stream0_IRQn);
+    HAL_NVIC_DisableIRQ(DMA2_Stream3_IRQn);
+    (void)HAL_DMA_DeInit(&g_spi_dma_rx_handle);
+    (void)HAL_DMA_DeInit(&g_spi_dma_tx_handle);
+    
     /* cs deinit */
     HAL_GPIO_DeInit(GPIOA, GPIO_PIN_4);
     
@@ -418,11 +500,12 @@ uint8_t spi_read_address16(uint16_t addr, uint8_t *buf, uint16_t len)
  * @return     status code
  *             - 0 success
  *             - 1 transmit failed
- * @note       none
+ * @note       the frame is sent by the full duplex dma and the cpu sleeps until it is finished,
+ *             the buffers must not be in the ccm ram
  */
 uint8_t spi_transmit(uint8_t *tx, uint8_t *rx, uint16_t len)
 {
-    uint8_t res;
+    uint32_t start;
     
     /* set cs low */
     HAL_GPIO_WritePin(GPIOA, GPIO_PIN_4, GPIO_PIN_RESET);
@@ -430,9 +513,39 @@ uint8_t spi_transmit(uint8_t *tx, uint8_t *rx, uint16_t len)
     /* if len > 0 */
     if (len > 0)
     {
-        /* transmit */
-        res = HAL_SPI_TransmitReceive(&g_spi_handle, tx, rx, len, 1000);
-        if (res != HAL_OK)
+        /* start the dma */
+        g_spi_dma_callback = NULL;
+        g_spi_dma_done = 0;
+        if (HAL_SPI_TransmitReceive_DMA(&g_spi_handle, tx, rx, len) != HAL_OK)
+        {
+            /* set cs high */
+            HAL_GPIO_WritePin(GPIOA, GPIO_PIN_4, GPIO_PIN_SET);
+            
+            return 1;
+        }
+        
+        /* sleep until the dma irq, the irq is masked between the check and the wfi */
+        start = HAL_GetTick();
+        while (g_spi_dma_done == 0)
+        {
+            if ((HAL_GetTick() - start) > 1000)
+            {
+                /* abort the dma */
+                (void)HAL_SPI_Abort(&g_spi_handle);
+                
+                /* set cs high */
+                HAL_GPIO_WritePin(GPIOA, GPIO_PIN_4, GPIO_PIN_SET);
+                
+                return 1;
+            }
+            __disable_irq();
+            if (g_spi_dma_done == 0)
+            {
+                __WFI();
+            }
+            __enable_irq();
+        }
+        if (g_spi_dma_done != 1)
         {
             /* set cs high */
             HAL_GPIO_WritePin(GPIOA, GPIO_PIN_4, GPIO_PIN_SET);
@@ -447,6 +560,129 @@ uint8_t spi_transmit(uint8_t *tx, uint8_t *rx, uint16_t len)
     return 0;
 }
 
+/**
+ * @brief      spi transmit with the dma in the background
+ * @param[in]  *tx pointer to a tx buffer
+ * @param[out] *rx pointer to a rx buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  *callback pointer to a finished callback
+ * @return     status code
+ *             - 0 success
+ *             - 1 transmit failed
+ * @note       cs is not changed, use spi_cs_hold,
+ *             the callback runs in the dma irq with 0 on success and 1 on error
+ */
+uint8_t spi_transmit_dma(uint8_t *tx, uint8_t *rx, uint16_t len, void (*callback)(uint8_t res))
+{
+    /* start the dma */
+    g_spi_dma_callback = callback;
+    g_spi_dma_done = 0;
+    if (HAL_SPI_TransmitReceive_DMA(&g_spi_handle, tx, rx, len) != HAL_OK)
+    {
+        g_spi_dma_callback = NULL;
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     spi cs hold
+ * @param[in] enable bool value
+ * @note      cs stays low while enable is 1
+ */
+void spi_cs_hold(uint8_t enable)
+{
+    HAL_GPIO_WritePin(GPIOA, GPIO_PIN_4, (enable != 0) ? GPIO_PIN_RESET : GPIO_PIN_SET);
+}
+
+/**
+ * @brief     spi drdy irq init
+ * @param[in] *callback pointer to a drdy callback
+ * @note      MISO PA6 is also the DOUT/DRDY pin, the falling edge of EXTI6 is used while cs is low,
+ *            the pin stays in the spi alternate function because its input is still sampled,
+ *            the irq is masked after the init
+ */
+void spi_drdy_irq_init(void (*callback)(void))
+{
+    /* enable syscfg clock */
+    __HAL_RCC_SYSCFG_CLK_ENABLE();
+    
+    /* route PA6 to EXTI6 with a falling edge */
+    EXTI->IMR &= ~EXTI_IMR_MR6;
+    SYSCFG->EXTICR[1] = (SYSCFG->EXTICR[1] & ~SYSCFG_EXTICR2_EXTI6) | SYSCFG_EXTICR2_EXTI6_PA;
+    EXTI->RTSR &= ~EXTI_RTSR_TR6;
+    EXTI->FTSR |= EXTI_FTSR_TR6;
+    g_spi_drdy_callback = callback;
+    
+    /* enable nvic, drdy starts the read before the dma irq finishes the last sample */
+    HAL_NVIC_SetPriority(EXTI9_5_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(EXTI9_5_IRQn);
+}
+
+/**
+ * @brief     spi drdy irq enable
+ * @param[in] enable bool value
+ * @note      the old pending edge is cleared before the irq is unmasked
+ */
+void spi_drdy_irq_enable(uint8_t enable)
+{
+    if (enable != 0)
+    {
+        __HAL_GPIO_EXTI_CLEAR_IT(GPIO_PIN_6);
+        EXTI->IMR |= EXTI_IMR_MR6;
+    }
+    else
+    {
+        EXTI->IMR &= ~EXTI_IMR_MR6;
+        __HAL_GPIO_EXTI_CLEAR_IT(GPIO_PIN_6);
+    }
+}
+
+/**
+ * @brief  spi get the handle
+ * @return pointer to a spi handle
+ * @note   none
+ */
+SPI_HandleTypeDef* spi_get_handle(void)
+{
+    return &g_spi_handle;
+}
+
+/**
+ * @brief     spi dma irq handler
+ * @param[in] res transmit result
+ * @note      none
+ */
+void spi_dma_irq_handler(uint8_t res)
+{
+    void (*callback)(uint8_t res);
+    
+    /* set the flag */
+    g_spi_dma_done = (res == 0) ? 1 : 2;
+    
+    /* run the callback once */
+    callback = g_spi_dma_callback;
+    g_spi_dma_callback = NULL;
+    if (callback != NULL)
+    {
+        callback(res);
+    }
+}
+
+/**
+ * @brief spi drdy irq handler
+ * @note  none
+ */
+void spi_drdy_irq_handler(void)
+{
+    if (g_spi_drdy_callback != NULL)
+    {
+        g_spi_drdy_callback();
+    }
+}
+
 /**
  * @brief      spi bus write read
  * @param[in]  *in_buf pointer to an input buffer
@@ -114,6 +114,24 @@ void USART1_IRQHandler(void);
  */
 void USART2_IRQHandler(void);
 
+/**
+ * @brief dma2 stream0 irq handler
+ * @note  none
+ */
+void DMA2_Stream0_IRQHandler(void);
+
+/**
+ * @brief dma2 stream3 irq handler
+ * @note  none
+ */
+void DMA2_Stream3_IRQHandler(void);
+
+/**
+ * @brief exti9_5 irq handler
+ * @note  none
+ */
+void EXTI9_5_IRQHandler(void);
+
 /**
  * @}
  */
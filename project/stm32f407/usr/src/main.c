@@ -39,6 +39,7 @@
 #include "driver_ads1118_register_test.h"
 #include "driver_ads1118_basic.h"
 #include "driver_ads1118_shot.h"
+#include "stm32f407_driver_ads1118_stream.h"
 #include "shell.h"
 #include "clock.h"
 #include "delay.h"
@@ -51,6 +52,9 @@
  */
 uint8_t g_buf[256];             /**< uart buffer */
 volatile uint16_t g_len;        /**< uart buffer length */
+static ads1118_handle_t gs_handle;                /**< ads1118 stream handle */
+static ads1118_sample_t gs_sample[256];           /**< stream sample buffer */
+static ads1118_ring_t gs_ring;                    /**< stream sample ring */
 
 /**
  * @brief     ads1118 full function
@@ -304,11 +308,37 @@ uint8_t ads1118(uint8_t argc, char **argv)
         }
         for (i = 0; i < times; i++)
         {
-            /* read the data */
-            res = ads1118_shot_read((float *)&s);
+            uint8_t ready;
+
+            /* start the conversion */
+            res = ads1118_shot_start();
             if (res != 0)
             {
-                ads1118_interface_debug_print("ads1118: shot read failed.\n");
+                ads1118_interface_debug_print("ads1118: shot start failed.\n");
+                (void)ads1118_shot_deinit();
+
+                return 1;
+            }
+
+            /* the cpu is free until the conversion is finished */
+            ready = 0;
+            while (ready == 0)
+            {
+                res = ads1118_shot_is_ready((uint8_t *)&ready);
+                if (res != 0)
+                {
+                    ads1118_interface_debug_print("ads1118: shot is ready failed.\n");
+                    (void)ads1118_shot_deinit();
+
+                    return 1;
+                }
+            }
+
+            /* fetch the data */
+            res = ads1118_shot_fetch((float *)&s);
+            if (res != 0)
+            {
+                ads1118_interface_debug_print("ads1118: shot fetch failed.\n");
                 (void)ads1118_shot_deinit();
 
                 return 1;
@@ -354,6 +384,92 @@ uint8_t ads1118(uint8_t argc, char **argv)
 
         return 0;
     }
+    else if (strcmp("e_stream", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        uint32_t len;
+        uint32_t frames;
+        uint32_t errors;
+        uint32_t overrun;
+        uint32_t start;
+        float s;
+        ads1118_sample_t sample;
+
+        /* link interface function */
+        DRIVER_ADS1118_LINK_INIT(&gs_handle, ads1118_handle_t);
+        DRIVER_ADS1118_LINK_SPI_INIT(&gs_handle, ads1118_interface_spi_init);
+        DRIVER_ADS1118_LINK_SPI_DEINIT(&gs_handle, ads1118_interface_spi_deinit);
+        DRIVER_ADS1118_LINK_SPI_TRANSMIT(&gs_handle, ads1118_interface_spi_transmit);
+        DRIVER_ADS1118_LINK_DELAY_MS(&gs_handle, ads1118_interface_delay_ms);
+        DRIVER_ADS1118_LINK_DELAY_US(&gs_handle, ads1118_interface_delay_us);
+        DRIVER_ADS1118_LINK_GET_TIME_US(&gs_handle, ads1118_interface_get_time_us);
+        DRIVER_ADS1118_LINK_DEBUG_PRINT(&gs_handle, ads1118_interface_debug_print);
+
+        /* ads1118 init */
+        res = ads1118_init(&gs_handle);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: init failed.\n");
+
+            return 1;
+        }
+
+        /* 860 SPS on the channel */
+        res = ads1118_batch_begin(&gs_handle);
+        res |= ads1118_set_channel(&gs_handle, channel);
+        res |= ads1118_set_range(&gs_handle, ADS1118_RANGE_4P096V);
+        res |= ads1118_set_rate(&gs_handle, ADS1118_RATE_860SPS);
+        res |= ads1118_set_mode(&gs_handle, ADS1118_MODE_ADC);
+        res |= ads1118_batch_end(&gs_handle);
+        res |= ads1118_ring_init(&gs_ring, gs_sample, 256);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: set config failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+
+            return 1;
+        }
+
+        /* start the stream */
+        res = ads1118_stream_start(&gs_handle, &gs_ring);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: stream start failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+
+            return 1;
+        }
+
+        /* the irq fills the ring, print one sample of every second */
+        i = 0;
+        start = HAL_GetTick();
+        while ((i < times * 860) && ((HAL_GetTick() - start) < (times + 1) * 1000))
+        {
+            len = 1;
+            (void)ads1118_ring_pop(&gs_ring, &sample, &len);
+            if (len == 0)
+            {
+                continue;
+            }
+            if ((i % 860) == 0)
+            {
+                (void)ads1118_raw_to_volts_n((ads1118_range_t)sample.range, &sample.raw, &s, 1);
+                ads1118_interface_debug_print("ads1118: %d/%d.\n", i / 860 + 1, times);
+                ads1118_interface_debug_print("ads1118: adc is %0.4fV.\n", s);
+            }
+            i++;
+        }
+
+        /* stop the stream */
+        res = ads1118_stream_stop();
+        ads1118_stream_get_count(&frames, &errors);
+        (void)ads1118_ring_get_overrun(&gs_ring, &overrun);
+        ads1118_interface_debug_print("ads1118: stream %d frames %d errors %d overruns.\n", frames, errors, overrun);
+        (void)ads1118_deinit(&gs_handle);
+
+        return ((res == 0) && (i == times * 860)) ? 0 : 1;
+    }
     else if (strcmp("h", type) == 0)
     {
         help:
@@ -370,11 +486,13 @@ uint8_t ads1118(uint8_t argc, char **argv)
         ads1118_interface_debug_print("  ads1118 (-e shot | --example=shot) [--times=<num>]\n");
         ads1118_interface_debug_print("          [--channel=<AIN0_AIN1 | AIN0_AIN3 | AIN1_AIN3 | AIN2_AIN3 | AIN0_GND | AIN1_GND | AIN2_GND | AIN3_GND>]\n");
         ads1118_interface_debug_print("  ads1118 (-e temperature | --example=temperature) [--times=<num>]\n");
+        ads1118_interface_debug_print("  ads1118 (-e stream | --example=stream) [--times=<num>]\n");
+        ads1118_interface_debug_print("          [--channel=<AIN0_AIN1 | AIN0_AIN3 | AIN1_AIN3 | AIN2_AIN3 | AIN0_GND | AIN1_GND | AIN2_GND | AIN3_GND>]\n");
         ads1118_interface_debug_print("\n");
         ads1118_interface_debug_print("Options:\n");
         ads1118_interface_debug_print("      --channel=<AIN0_AIN1 | AIN0_AIN3 | AIN1_AIN3 | AIN2_AIN3 | AIN0_GND | AIN1_GND | AIN2_GND | AIN3_GND>\n");
         ads1118_interface_debug_print("                                         Set the ADC channel.([default: AIN0_GND])\n");
-        ads1118_interface_debug_print("  -e <read | shot | temperature>, --example=<read | shot | temperature>\n");
+        ads1118_interface_debug_print("  -e <read | shot | temperature | stream>, --example=<read | shot | temperature | stream>\n");
         ads1118_interface_debug_print("                                         Run the driver example.\n");
         ads1118_interface_debug_print("  -h, --help                             Show the help.\n");
         ads1118_interface_debug_print("  -i, --information                      Show the chip information.\n");
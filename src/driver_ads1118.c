@@ -35,6 +35,15 @@
  */
 
 #include "driver_ads1118.h"
+#include <math.h>
+
+#if !defined(ADS1118_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+    #include <emmintrin.h>
+    #define ADS1118_SIMD_SSE2        /**< sse2 bulk conversion */
+#elif !defined(ADS1118_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+    #include <arm_neon.h>
+    #define ADS1118_SIMD_NEON        /**< neon bulk conversion */
+#endif
 
 /**
  * @brief chip information definition
@@ -52,978 +61,5672 @@
  * @brief command definition
  */
 #define COMMAND_VALID        (1 << 1)        /**< valid command */
+#define CONFIG_MASK          0x7FF8U         /**< mux, pga, mode, dr, ts_mode and pull_up_en bits */
 
 /**
- * @brief      read bytes
+ * @brief ring counter access definition
+ * @note  the producer and the consumer may run on different cores,
+ *        so the counters are published with release and read with acquire ordering
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define RING_LOAD(p)            __atomic_load_n((p), __ATOMIC_ACQUIRE)          /**< load acquire */
+#define RING_STORE(p, v)        __atomic_store_n((p), (v), __ATOMIC_RELEASE)    /**< store release */
+#else
+#define RING_LOAD(p)            (*(p))                                          /**< volatile load */
+#define RING_STORE(p, v)        (*(p) = (v))                                    /**< volatile store */
+#endif
+
+/**
+ * @brief drdy poll definition
+ */
+#define DRDY_POLL_US            20          /**< drdy poll interval in us */
+#define DRDY_TIMEOUT_US         1000        /**< drdy timeout margin in us */
+
+/**
+ * @brief running api definition
+ * @note  the macro is empty when neither the counters nor the trace are compiled in
+ */
+#if (ADS1118_STATS_ENABLE != 0) || (ADS1118_TRACE_ENABLE != 0)
+#define SET_API(h, a)           do { (h)->api = (uint8_t)(a); } while (0)                 /**< set the running api */
+#else
+#define SET_API(h, a)           do { } while (0)                                          /**< no running api */
+#endif
+
+/**
+ * @brief hot path counters definition
+ * @note  the macros are empty when ADS1118_STATS_ENABLE is 0
+ */
+#if (ADS1118_STATS_ENABLE != 0)
+#define STATS_ADD(h, f, n)      do { (h)->stats.f += (n); } while (0)                     /**< add to a counter */
+#define STATS_ERROR(h)          do { (h)->stats.error[(h)->api]++; } while (0)            /**< count an api error */
+#else
+#define STATS_ADD(h, f, n)      do { } while (0)                                          /**< no counter */
+#define STATS_ERROR(h)          do { } while (0)                                          /**< no counter */
+#endif
+
+/**
+ * @brief     get the time
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @return    time in us
+ * @note      0 is returned if get_time_us is not linked
+ */
+static uint64_t a_ads1118_get_time_us(ads1118_handle_t *handle)
+{
+    if (handle->get_time_us == NULL)        /* check get_time_us */
+    {
+        return 0;                           /* no time */
+    }
+    
+    return handle->get_time_us();           /* return the time */
+}
+
+/**
+ * @brief      transmit one frame with the linked spi function
  * @param[in]  *handle pointer to an ads1118 handle structure
- * @param[out] *data pointer to a data buffer
+ * @param[in]  *tx pointer to a tx buffer
+ * @param[out] *rx pointer to a rx buffer
+ * @param[in]  len frame length
  * @return     status code
  *             - 0 success
- *             - 1 read failed
- * @note       none
+ *             - 1 transmit failed
+ * @note       spi_transmit_ctx is used with the user context if it is linked
  */
-static uint8_t a_ads1118_spi_read(ads1118_handle_t *handle, uint16_t *data)
+static uint8_t a_ads1118_spi_transmit(ads1118_handle_t *handle, uint8_t *tx, uint8_t *rx, uint16_t len)
 {
-    uint8_t tx_buf[4];
-    uint8_t rx_buf[4];
-    
-    tx_buf[0] = 0xFF;                                                  /* 0xFF */
-    tx_buf[1] = 0xFF;                                                  /* 0xFF */
-    tx_buf[2] = 0xFF;                                                  /* 0xFF */
-    tx_buf[3] = 0xFF;                                                  /* 0xFF */
-    if (handle->spi_transmit(tx_buf, rx_buf, 4) != 0)                  /* transmit */
+    if (handle->spi_transmit_ctx != NULL)                                 /* check the ctx function */
     {
-        return 1;                                                      /* return error */
+        return handle->spi_transmit_ctx(handle->user, tx, rx, len);       /* transmit with the context */
     }
-    *data = (uint16_t)((uint16_t)(rx_buf[2]) << 8) | rx_buf[3];        /* get data */
     
-    return 0;                                                          /* success return 0 */
+    return handle->spi_transmit(tx, rx, len);                             /* transmit */
 }
 
 /**
- * @brief      read data bytes
+ * @brief      read the dout/drdy level with the linked function
  * @param[in]  *handle pointer to an ads1118 handle structure
- * @param[out] *data pointer to a data buffer
+ * @param[out] *level pointer to a level buffer
  * @return     status code
  *             - 0 success
  *             - 1 read failed
- * @note       none
+ * @note       drdy_read_ctx is used with the user context if it is linked
  */
-static uint8_t a_ads1118_spi_read_data(ads1118_handle_t *handle, int16_t *data)
+static uint8_t a_ads1118_drdy_read(ads1118_handle_t *handle, uint8_t *level)
 {
-    uint8_t tx_buf[2];
-    uint8_t rx_buf[2];
-    
-    tx_buf[0] = 0xFF;                                                 /* 0xFF */
-    tx_buf[1] = 0xFF;                                                 /* 0xFF */
-    if (handle->spi_transmit(tx_buf, rx_buf, 2) != 0)                 /* transmit */
+    if (handle->drdy_read_ctx != NULL)                                    /* check the ctx function */
     {
-        return 1;                                                     /* return error */
+        return handle->drdy_read_ctx(handle->user, level);                /* read with the context */
     }
-    *data = (int16_t)((uint16_t)(rx_buf[0]) << 8) | rx_buf[1];        /* get data */
     
-    return 0;                                                         /* success return 0 */
+    return handle->drdy_read(level);                                      /* read */
 }
 
 /**
- * @brief     write bytes
+ * @brief     open the spi bus with the linked function
  * @param[in] *handle pointer to an ads1118 handle structure
- * @param[in] data sent data
  * @return    status code
  *            - 0 success
- *            - 1 write failed
- * @note      none
+ *            - 1 spi init failed
+ * @note      spi_init_ctx is used with the user context if it is linked
  */
-static uint8_t a_ads1118_spi_write(ads1118_handle_t *handle, uint16_t data)
+static uint8_t a_ads1118_spi_init(ads1118_handle_t *handle)
 {
-    uint8_t tx_buf[2];
-    uint8_t rx_buf[2];
-    
-    tx_buf[0] = (data >> 8) & 0xFF;                          /* set msb */
-    tx_buf[1] = (data >> 0) & 0xFF;                          /* set lsb */
-    if (handle->spi_transmit(tx_buf, rx_buf, 2) != 0)        /* transmit */
+    if (handle->spi_init_ctx != NULL)                       /* check the ctx function */
     {
-        return 1;                                            /* return error */
+        return handle->spi_init_ctx(handle->user);          /* init with the context */
     }
     
-    return 0;                                                /* success return 0 */
+    return handle->spi_init();                              /* init */
 }
 
 /**
- * @brief     initialize the chip
+ * @brief     close the spi bus with the linked function
  * @param[in] *handle pointer to an ads1118 handle structure
  * @return    status code
  *            - 0 success
- *            - 1 spi initialization failed
- *            - 2 handle is NULL
- *            - 3 linked functions is NULL
- * @note      none
+ *            - 1 spi deinit failed
+ * @note      spi_deinit_ctx is used with the user context if it is linked
  */
-uint8_t ads1118_init(ads1118_handle_t *handle)
+static uint8_t a_ads1118_spi_deinit(ads1118_handle_t *handle)
 {
-    if (handle == NULL)                                              /* check handle */
-    {
-        return 2;                                                    /* return error */
-    }
-    if (handle->debug_print == NULL)                                 /* check debug_print */
+    if (handle->spi_deinit_ctx != NULL)                     /* check the ctx function */
     {
-        return 3;                                                    /* return error */
-    }
-    if (handle->spi_init == NULL)                                    /* check spi_init */
-    {
-        handle->debug_print("ads1118: spi_init is null.\n");         /* spi_init is null */
-        
-        return 3;                                                    /* return error */
+        return handle->spi_deinit_ctx(handle->user);        /* deinit with the context */
     }
-    if (handle->spi_deinit == NULL)                                  /* check spi_deinit */
+    
+    return handle->spi_deinit();                            /* deinit */
+}
+
+#if (ADS1118_TRACE_ENABLE != 0)
+/**
+ * @brief     add a trace entry
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] type trace type
+ * @param[in] *tx pointer to a tx buffer
+ * @param[in] *rx pointer to a rx buffer
+ * @param[in] len frame length
+ * @param[in] t0 start time in us
+ * @param[in] res transmit return code
+ * @note      the oldest entry is overwritten when the ring is full
+ */
+static void a_ads1118_trace_add(ads1118_handle_t *handle, ads1118_trace_type_t type,
+                                const uint8_t *tx, const uint8_t *rx, uint16_t len, uint64_t t0, uint8_t res)
+{
+    uint8_t i;
+    ads1118_trace_t *e;
+    
+    e = &handle->trace[handle->trace_seq & (ADS1118_TRACE_DEPTH - 1)];        /* get the entry */
+    e->timestamp = t0;                                                        /* set start time */
+    e->duration = (uint32_t)(a_ads1118_get_time_us(handle) - t0);             /* set transmit time */
+    e->seq = handle->trace_seq;                                               /* set sequence number */
+    e->len = len;                                                             /* set length */
+    e->type = (uint8_t)type;                                                  /* set type */
+    e->api = handle->api;                                                     /* set running api */
+    e->res = res;                                                             /* set return code */
+    for (i = 0; i < 4; i++)                                                   /* copy the first bytes */
     {
-        handle->debug_print("ads1118: spi_deinit is null.\n");       /* spi_deinit is null */
-        
-        return 3;                                                    /* return error */
+        e->tx[i] = (i < len) ? tx[i] : 0x00;                                  /* set tx */
+        e->rx[i] = (i < len) ? rx[i] : 0x00;                                  /* set rx */
     }
-    if (handle->spi_transmit == NULL)                                /* check spi_transmit */
+    handle->trace_seq++;                                                      /* next entry */
+}
+#endif
+
+/**
+ * @brief     transmit one frame
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] type trace type
+ * @param[in] *tx pointer to a tx buffer
+ * @param[in] *rx pointer to a rx buffer
+ * @param[in] len frame length
+ * @return    status code
+ *            - 0 success
+ *            - 1 transmit failed
+ * @note      every spi frame of the driver goes through this function
+ */
+static uint8_t a_ads1118_transmit(ads1118_handle_t *handle, ads1118_trace_type_t type,
+                                  uint8_t *tx, uint8_t *rx, uint16_t len)
+{
+    uint8_t res;
+    
+#if (ADS1118_TRACE_ENABLE != 0)
+    if (handle->trace_enable != 0)                                     /* check trace */
     {
-        handle->debug_print("ads1118: spi_transmit is null.\n");     /* spi_transmit is null */
+        uint64_t t0;
         
-        return 3;                                                    /* return error */
+        t0 = a_ads1118_get_time_us(handle);                            /* get start time */
+        res = a_ads1118_spi_transmit(handle, tx, rx, len);             /* transmit */
+        a_ads1118_trace_add(handle, type, tx, rx, len, t0, res);       /* add the entry */
     }
-    if (handle->delay_ms == NULL)                                    /* check delay_ms */
+    else
     {
-        handle->debug_print("ads1118: delay_ms is null.\n");         /* delay_ms is null */
-        
-        return 3;                                                    /* return error */
+        res = a_ads1118_spi_transmit(handle, tx, rx, len);             /* transmit */
     }
-    
-    if (handle->spi_init() != 0)                                     /* spi init */
+#else
+    (void)type;                                                        /* not used */
+    res = a_ads1118_spi_transmit(handle, tx, rx, len);                 /* transmit */
+#endif
+    handle->fetch_pending = 0;                                         /* any frame ends the pipeline */
+    STATS_ADD(handle, transfers, 1);                                   /* count the frame */
+    STATS_ADD(handle, bytes, len);                                     /* count the bytes */
+    if (res != 0)                                                      /* check the result */
     {
-        handle->debug_print("ads1118: spi init failed.\n");          /* spi init failed */
+        STATS_ADD(handle, transfer_errors, 1);                         /* count the failed frame */
+        STATS_ERROR(handle);                                           /* count the api error */
         
-        return 1;                                                    /* return error */
+        return 1;                                                      /* return error */
     }
-    handle->inited = 1;                                              /* flag inited */
     
-    return 0;                                                        /* success return 0 */
+    return 0;                                                          /* success return 0 */
 }
 
 /**
- * @brief     close the chip
+ * @brief     delay us
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] us time
+ * @note      delay_us must be linked
+ */
+static void a_ads1118_delay_us(ads1118_handle_t *handle, uint32_t us)
+{
+    STATS_ADD(handle, delay_us, us);        /* count the delay */
+    handle->delay_us(us);                   /* delay */
+}
+
+/**
+ * @brief     delay ms
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] ms time
+ * @note      none
+ */
+static void a_ads1118_delay_ms(ads1118_handle_t *handle, uint32_t ms)
+{
+    STATS_ADD(handle, delay_us, (uint64_t)ms * 1000);        /* count the delay */
+    handle->delay_ms(ms);                                    /* delay */
+}
+
+/**
+ * @brief     flush the queued frames
  * @param[in] *handle pointer to an ads1118 handle structure
  * @return    status code
  *            - 0 success
- *            - 1 spi deinit failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- *            - 4 power down failed
+ *            - 1 flush failed
  * @note      none
  */
-uint8_t ads1118_deinit(ads1118_handle_t *handle)
+static uint8_t a_ads1118_batch_flush(ads1118_handle_t *handle)
 {
+    uint8_t i;
     uint8_t res;
-    uint16_t conf;
     
-    if (handle == NULL)                                                /* check handle */
-    {
-        return 2;                                                      /* return error */
-    }
-    if (handle->inited != 1)                                           /* check handle initialization */
+    if (handle->batch_len == 0)                                                  /* check queue */
     {
-        return 3;                                                      /* return error */
+        return 0;                                                                /* nothing to send */
     }
     
-    res = a_ads1118_spi_read(handle, (uint16_t *)&conf);               /* read config */
-    if (res != 0)                                                      /* check error */
+    res = 0;                                                                     /* init 0 */
+    if ((handle->spi_transmit_batch != NULL) &&
+        (handle->spi_transmit_ctx == NULL))                                      /* one bus transaction */
     {
-        handle->debug_print("ads1118: read config failed.\n");         /* read config failed */
+#if (ADS1118_TRACE_ENABLE != 0)
+        uint64_t t0;
+        uint16_t bytes;
         
-        return 4;                                                      /* return error */
+        t0 = a_ads1118_get_time_us(handle);                                      /* get start time */
+        res = handle->spi_transmit_batch(handle->batch, handle->batch_len);      /* transmit all frames */
+        bytes = 0;                                                               /* init 0 */
+        for (i = 0; i < handle->batch_len; i++)                                  /* sum all frames */
+        {
+            bytes += handle->batch[i].len;                                       /* add the length */
+        }
+        if (handle->trace_enable != 0)                                           /* check trace */
+        {
+            a_ads1118_trace_add(handle, ADS1118_TRACE_TYPE_BATCH, handle->batch[0].tx,
+                                handle->batch[0].rx, bytes, t0, res);            /* add the entry */
+        }
+#else
+        res = handle->spi_transmit_batch(handle->batch, handle->batch_len);      /* transmit all frames */
+#endif
+        for (i = 0; i < handle->batch_len; i++)                                  /* count every frame */
+        {
+            STATS_ADD(handle, transfers, 1);                                     /* count the frame */
+            STATS_ADD(handle, bytes, handle->batch[i].len);                      /* count the bytes */
+        }
+        if (res != 0)                                                            /* check the result */
+        {
+            STATS_ADD(handle, transfer_errors, 1);                               /* count the failed batch */
+            STATS_ERROR(handle);                                                 /* count the api error */
+        }
     }
-    conf &= ~(0x01 << 8);                                              /* clear bit */
-    conf |= 1 << 8;                                                    /* set stop continues read */
-    res = a_ads1118_spi_write(handle, conf);                           /* write config */
-    if (res != 0)                                                      /* check error */
+    else
     {
-        handle->debug_print("ads1118: write config failed.\n");        /* write config failed */
-        
-        return 4;                                                      /* return error */
+        for (i = 0; i < handle->batch_len; i++)                                  /* one frame per call */
+        {
+            if (a_ads1118_transmit(handle, ADS1118_TRACE_TYPE_BATCH,
+                                   handle->batch[i].tx, handle->batch[i].rx,
+                                   handle->batch[i].len) != 0)                   /* transmit */
+            {
+                res = 1;                                                         /* set error */
+                
+                break;                                                           /* break */
+            }
+        }
     }
-    res = handle->spi_deinit();                                        /* close spi */
-    if (res != 0)                                                      /* check the result */
+    handle->batch_len = 0;                                                       /* clear queue */
+    
+    return (res != 0) ? 1 : 0;                                                   /* return the result */
+}
+
+/**
+ * @brief     queue a frame
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] *tx pointer to a tx buffer
+ * @param[in] *rx pointer to a rx buffer
+ * @param[in] len frame length
+ * @return    status code
+ *            - 0 success
+ *            - 1 queue failed
+ * @note      a full queue is flushed first
+ */
+static uint8_t a_ads1118_batch_push(ads1118_handle_t *handle, uint8_t *tx, uint8_t *rx, uint16_t len)
+{
+    if (handle->batch_len >= ADS1118_BATCH_MAX)                 /* check full */
     {
-        handle->debug_print("ads1118: spi deinit failed.\n");          /* spi deinit failed */
-        
-        return 1;                                                      /* return error */
+        if (a_ads1118_batch_flush(handle) != 0)                 /* flush */
+        {
+            return 1;                                           /* return error */
+        }
     }
-    handle->inited = 0;                                                /* flag close */
+    handle->batch[handle->batch_len].tx = tx;                   /* set tx */
+    handle->batch[handle->batch_len].rx = rx;                   /* set rx */
+    handle->batch[handle->batch_len].len = len;                 /* set len */
+    handle->batch_len++;                                        /* queue it */
     
-    return 0;                                                          /* success return 0 */
+    return 0;                                                   /* success return 0 */
 }
 
 /**
- * @brief     set the adc channel
+ * @brief     queue a config write
  * @param[in] *handle pointer to an ads1118 handle structure
- * @param[in] channel adc channel
+ * @param[in] data config data
  * @return    status code
  *            - 0 success
- *            - 1 set channel failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ *            - 1 queue failed
+ * @note      a queued config write directly before replaces the old one,
+ *            the chip only keeps the last written config
  */
-uint8_t ads1118_set_channel(ads1118_handle_t *handle, ads1118_channel_t channel)
+static uint8_t a_ads1118_batch_write(ads1118_handle_t *handle, uint16_t data)
 {
-    uint8_t res;
-    uint16_t conf;
+    uint8_t n;
     
-    if (handle == NULL)                                                /* check handle */
+    n = handle->batch_len;                                                       /* get queue length */
+    if ((n != 0) && (handle->batch[n - 1].tx == handle->batch_buf[n - 1]))       /* last frame is a config write */
     {
-        return 2;                                                      /* return error */
+        handle->batch_buf[n - 1][0] = (data >> 8) & 0xFF;                        /* set msb */
+        handle->batch_buf[n - 1][1] = (data >> 0) & 0xFF;                        /* set lsb */
+        
+        return 0;                                                                /* success return 0 */
     }
-    if (handle->inited != 1)                                           /* check handle initialization */
+    if (n >= ADS1118_BATCH_MAX)                                                  /* check full */
     {
-        return 3;                                                      /* return error */
+        if (a_ads1118_batch_flush(handle) != 0)                                  /* flush */
+        {
+            return 1;                                                            /* return error */
+        }
+        n = 0;                                                                   /* queue is empty */
     }
+    handle->batch_buf[n][0] = (data >> 8) & 0xFF;                                /* set msb */
+    handle->batch_buf[n][1] = (data >> 0) & 0xFF;                                /* set lsb */
     
-    res = a_ads1118_spi_read(handle, (uint16_t *)&conf);               /* read config */
-    if (res != 0)                                                      /* check error */
+    return a_ads1118_batch_push(handle, &handle->batch_buf[n][0],
+                                &handle->batch_buf[n][2], 2);                    /* queue the frame */
+}
+
+/**
+ * @brief      read bytes
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *data pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_ads1118_spi_read(ads1118_handle_t *handle, uint16_t *data)
+{
+    uint8_t tx_buf[4];
+    uint8_t rx_buf[4];
+    
+    tx_buf[0] = 0xFF;                                                  /* 0xFF */
+    tx_buf[1] = 0xFF;                                                  /* 0xFF */
+    tx_buf[2] = 0xFF;                                                  /* 0xFF */
+    tx_buf[3] = 0xFF;                                                  /* 0xFF */
+    STATS_ADD(handle, config_reads, 1);                                /* count the config read */
+    if (a_ads1118_batch_flush(handle) != 0)                            /* send the queued frames first */
     {
-        handle->debug_print("ads1118: read config failed.\n");         /* read config failed */
-        
         return 1;                                                      /* return error */
     }
-    conf &= ~(0x07 << 12);                                             /* clear channel */
-    conf |= (channel & 0x07) << 12;                                    /* set channel */
-    conf &= ~(3 << 1);                                                 /* clear nop */
-    conf |= COMMAND_VALID;                                             /* set command valid */
-    res = a_ads1118_spi_write(handle, conf);                           /* write config */
-    if (res != 0)                                                      /* check error */
+    if (a_ads1118_transmit(handle, ADS1118_TRACE_TYPE_READ_CONFIG,
+                           tx_buf, rx_buf, 4) != 0)                    /* transmit */
     {
-        handle->debug_print("ads1118: write config failed.\n");        /* write config failed */
-        
         return 1;                                                      /* return error */
     }
+    *data = (uint16_t)((uint16_t)(rx_buf[2]) << 8) | rx_buf[3];        /* get data */
     
     return 0;                                                          /* success return 0 */
 }
 
 /**
- * @brief      get the adc channel
+ * @brief      read data bytes
  * @param[in]  *handle pointer to an ads1118 handle structure
- * @param[out] *channel pointer to a channel buffer
+ * @param[out] *data pointer to a data buffer
  * @return     status code
  *             - 0 success
- *             - 1 get channel failed
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
+ *             - 1 read failed
  * @note       none
  */
-uint8_t ads1118_get_channel(ads1118_handle_t *handle, ads1118_channel_t *channel)
+static uint8_t a_ads1118_spi_read_data(ads1118_handle_t *handle, int16_t *data)
 {
-    uint8_t res;
-    uint16_t conf;
+    uint8_t tx_buf[2];
+    uint8_t rx_buf[2];
     
-    if (handle == NULL)                                               /* check handle */
-    {
-        return 2;                                                     /* return error */
-    }
-    if (handle->inited != 1)                                          /* check handle initialization */
+    tx_buf[0] = 0xFF;                                                 /* 0xFF */
+    tx_buf[1] = 0xFF;                                                 /* 0xFF */
+    if (a_ads1118_batch_flush(handle) != 0)                           /* send the queued frames first */
     {
-        return 3;                                                     /* return error */
+        return 1;                                                     /* return error */
     }
-    
-    res = a_ads1118_spi_read(handle, (uint16_t *)&conf);              /* read config */
-    if (res != 0)                                                     /* check error */
+    handle->data_time = a_ads1118_get_time_us(handle);                /* time of the data read */
+    if (a_ads1118_transmit(handle, ADS1118_TRACE_TYPE_READ_DATA,
+                           tx_buf, rx_buf, 2) != 0)                   /* transmit */
     {
-        handle->debug_print("ads1118: read config failed.\n");        /* read config failed */
-        
         return 1;                                                     /* return error */
     }
-    *channel = (ads1118_channel_t)((conf >> 12) & 0x07);              /* get channel */
+    *data = (int16_t)((uint16_t)(rx_buf[0]) << 8) | rx_buf[1];        /* get data */
     
     return 0;                                                         /* success return 0 */
 }
 
 /**
- * @brief     set the adc range
+ * @brief     write bytes
  * @param[in] *handle pointer to an ads1118 handle structure
- * @param[in] range adc max voltage range
+ * @param[in] data sent data
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      in the batch mode a plain config write of the current mode is queued,
+ *            a write that starts a single conversion or changes the mode is sent at once after the queue
+ */
+static uint8_t a_ads1118_spi_write(ads1118_handle_t *handle, uint16_t data)
+{
+    uint8_t tx_buf[2];
+    uint8_t rx_buf[2];
+    
+    STATS_ADD(handle, config_writes, 1);                                /* count the config write */
+    if ((handle->batch_enable != 0) && ((data & (1 << 15)) == 0) &&
+        (((data >> 8) & 0x01) == handle->chip_mode))                    /* check batch mode */
+    {
+        return a_ads1118_batch_write(handle, data);                     /* queue the config */
+    }
+    tx_buf[0] = (data >> 8) & 0xFF;                                     /* set msb */
+    tx_buf[1] = (data >> 0) & 0xFF;                                     /* set lsb */
+    if (a_ads1118_batch_flush(handle) != 0)                             /* send the queued frames first */
+    {
+        return 1;                                                       /* return error */
+    }
+    if (a_ads1118_transmit(handle, ADS1118_TRACE_TYPE_WRITE,
+                           tx_buf, rx_buf, 2) != 0)                     /* transmit */
+    {
+        return 1;                                                       /* return error */
+    }
+    handle->chip_mode = (uint8_t)((data >> 8) & 0x01);                  /* the chip holds the mode */
+    
+    return 0;                                                           /* success return 0 */
+}
+
+/**
+ * @brief      write bytes and read data bytes
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  data sent data
+ * @param[out] *prev pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       the data register is shifted out while the config is shifted in
+ */
+static uint8_t a_ads1118_spi_write_read_data(ads1118_handle_t *handle, uint16_t data, int16_t *prev)
+{
+    uint8_t tx_buf[2];
+    uint8_t rx_buf[2];
+    
+    STATS_ADD(handle, config_writes, 1);                              /* count the config write */
+    tx_buf[0] = (data >> 8) & 0xFF;                                   /* set msb */
+    tx_buf[1] = (data >> 0) & 0xFF;                                   /* set lsb */
+    if (a_ads1118_batch_flush(handle) != 0)                           /* send the queued frames first */
+    {
+        return 1;                                                     /* return error */
+    }
+    handle->data_time = a_ads1118_get_time_us(handle);                /* time of the data read */
+    if (a_ads1118_transmit(handle, ADS1118_TRACE_TYPE_WRITE_READ,
+                           tx_buf, rx_buf, 2) != 0)                   /* transmit */
+    {
+        return 1;                                                     /* return error */
+    }
+    handle->chip_mode = (uint8_t)((data >> 8) & 0x01);                /* the chip holds the mode */
+    *prev = (int16_t)((uint16_t)(rx_buf[0]) << 8) | rx_buf[1];        /* get data */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief     make the single shot config of a slot
+ * @param[in] conf current config
+ * @param[in] *slot pointer to an ads1118 slot structure
+ * @return    slot config
+ * @note      the single shot start bit is not set
+ */
+static uint16_t a_ads1118_slot_config(uint16_t conf, const ads1118_slot_t *slot)
+{
+    conf &= ~(0x07 << 12);                                   /* clear channel */
+    conf |= (slot->channel & 0x07) << 12;                    /* set channel */
+    conf &= ~(0x07 << 9);                                    /* clear range */
+    conf |= (slot->range & 0x07) << 9;                       /* set range */
+    conf &= ~(0x01 << 8);                                    /* clear bit */
+    conf |= 1 << 8;                                          /* set single read */
+    conf &= ~(0x07 << 5);                                    /* clear rate */
+    conf |= (slot->rate & 0x07) << 5;                        /* set rate */
+    conf &= ~(1 << 4);                                       /* clear settings */
+    conf |= (slot->mode & 0x01) << 4;                        /* set mode */
+    conf &= ~(3 << 1);                                       /* clear nop */
+    conf |= COMMAND_VALID;                                   /* set command valid */
+    
+    return conf;                                             /* return config */
+}
+
+/**
+ * @brief     put the auto range of the channel into a config
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] conf config
+ * @return    config with the auto range
+ * @note      the config is kept in the temperature mode or with the auto range disabled
+ */
+static uint16_t a_ads1118_autorange_conf(ads1118_handle_t *handle, uint16_t conf)
+{
+    if ((handle->autorange_enable != 0) && ((conf & (1 << 4)) == 0))                  /* auto range in the adc mode */
+    {
+        conf &= ~(0x07 << 9);                                                         /* clear range bits */
+        conf |= (uint16_t)(handle->autorange[(conf >> 12) & 0x07] << 9);              /* set the channel range */
+    }
+    
+    return conf;                                                                      /* return config */
+}
+
+/**
+ * @brief     update the auto range of a channel from a result
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] conf config of the conversion
+ * @param[in] raw conversion result
+ * @note      a code of ADS1118_AUTORANGE_HIGH or more goes one range up,
+ *            a code under ADS1118_AUTORANGE_LOW goes one range down,
+ *            the gap between them is the hysteresis
+ */
+static void a_ads1118_autorange_update(ads1118_handle_t *handle, uint16_t conf, int16_t raw)
+{
+    uint8_t range;
+    int32_t mag;
+    
+    if ((handle->autorange_enable == 0) || ((conf & (1 << 4)) != 0))                  /* auto range in the adc mode */
+    {
+        return;                                                                       /* return */
+    }
+    range = (uint8_t)((conf >> 9) & 0x07);                                            /* get range conf */
+    if (range > ADS1118_RANGE_0P256V)                                                 /* 6 and 7 are 0.256V too */
+    {
+        range = ADS1118_RANGE_0P256V;                                                 /* set 0.256V */
+    }
+    mag = (raw < 0) ? -(int32_t)raw : (int32_t)raw;                                   /* get magnitude */
+    if ((mag >= ADS1118_AUTORANGE_HIGH) && (range > ADS1118_RANGE_6P144V))            /* saturated */
+    {
+        range--;                                                                      /* larger range */
+    }
+    else if ((mag < ADS1118_AUTORANGE_LOW) && (range < ADS1118_RANGE_0P256V))         /* under used */
+    {
+        range++;                                                                      /* smaller range */
+    }
+    handle->autorange[(conf >> 12) & 0x07] = range;                                   /* remember the range */
+}
+
+/**
+ * @brief      fill the tag of a sample
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  conf config of the conversion
+ * @param[out] *sample pointer to a sample
+ * @note       the timestamp is the time of the last data read frame
+ */
+static void a_ads1118_sample_tag(ads1118_handle_t *handle, uint16_t conf, ads1118_sample_t *sample)
+{
+    sample->timestamp = handle->data_time;                            /* time of the data read */
+    sample->channel = (uint8_t)((conf >> 12) & 0x07);                 /* set channel */
+    sample->range = (uint8_t)((conf >> 9) & 0x07);                    /* set range */
+    sample->rate = (uint8_t)((conf >> 5) & 0x07);                     /* set rate */
+    sample->device = 0;                                               /* single device */
+    sample->status = ADS1118_CONTINUOUS_STATUS_FRESH;                 /* new conversion */
+    sample->skipped = 0;                                              /* nothing missed */
+}
+
+/**
+ * @brief conversion time definition
+ */
+static const uint32_t gs_conversion_us[8] =
+{
+    125000, 62500, 31250, 15625, 7813, 4000, 2106, 1163,        /* 1000000 / 8 ... 1000000 / 860 */
+};
+
+/**
+ * @brief     poll dout/drdy until the data is ready
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] t expected waiting time in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 drdy read failed
+ *            - 2 conversion timeout
+ * @note      the minimum time is skipped with delay_us if it is linked
+ */
+static uint8_t a_ads1118_poll_drdy(ads1118_handle_t *handle, uint32_t t)
+{
+    uint8_t level;
+    uint32_t timeout;
+    
+    timeout = t + t / 10 + DRDY_TIMEOUT_US;                           /* time + 10% + margin */
+    if (handle->delay_us != NULL)                                     /* if delay_us is linked */
+    {
+        a_ads1118_delay_us(handle, t - t / 10);                       /* skip the minimum time */
+        t = t - t / 10;                                               /* set the elapsed time */
+    }
+    else
+    {
+        t = 0;                                                        /* init 0 */
+    }
+    while (1)                                                         /* poll */
+    {
+        STATS_ADD(handle, drdy_reads, 1);                             /* count the drdy read */
+        if (a_ads1118_drdy_read(handle, (uint8_t *)&level) != 0)      /* read drdy */
+        {
+            handle->debug_print("ads1118: drdy read failed.\n");      /* drdy read failed */
+            STATS_ERROR(handle);                                      /* count the api error */
+            
+            return 1;                                                 /* return error */
+        }
+        if (level == 0)                                               /* check data ready */
+        {
+            return 0;                                                 /* success return 0 */
+        }
+        if (t >= timeout)                                             /* check timeout */
+        {
+            handle->debug_print("ads1118: conversion timeout.\n");    /* conversion timeout */
+            STATS_ERROR(handle);                                      /* count the api error */
+            
+            return 2;                                                 /* return error */
+        }
+        if (handle->delay_us != NULL)                                 /* if delay_us is linked */
+        {
+            a_ads1118_delay_us(handle, DRDY_POLL_US);                 /* poll interval */
+            t += DRDY_POLL_US;                                        /* add the elapsed time */
+        }
+        else
+        {
+            a_ads1118_delay_ms(handle, 1);                            /* poll interval */
+            t += 1000;                                                /* add the elapsed time */
+        }
+    }
+}
+
+/**
+ * @brief      wait the data period in the continuous mode
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  rate adc sample rate
+ * @return     status code
+ *             - 0 success
+ *             - 1 drdy read failed
+ *             - 2 conversion timeout
+ * @note       with drdy_read linked the function returns as soon as dout/drdy goes low,
+ *             otherwise the nominal data period is waited
+ */
+static uint8_t a_ads1118_wait_period(ads1118_handle_t *handle, ads1118_rate_t rate)
+{
+    uint32_t t;
+    
+    t = gs_conversion_us[rate & 0x07];                     /* get data period */
+    if ((handle->drdy_read != NULL) ||
+        (handle->drdy_read_ctx != NULL))                   /* poll drdy */
+    {
+        return a_ads1118_poll_drdy(handle, t);             /* wait drdy */
+    }
+    if (handle->delay_us != NULL)                          /* if delay_us is linked */
+    {
+        a_ads1118_delay_us(handle, t);                     /* wait data period */
+    }
+    else
+    {
+        a_ads1118_delay_ms(handle, (t + 999) / 1000);      /* wait data period */
+    }
+    
+    return 0;                                              /* success return 0 */
+}
+
+/**
+ * @brief      wait the conversion time
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  rate adc sample rate
+ * @return     status code
+ *             - 0 success
+ *             - 1 drdy read failed
+ *             - 2 conversion timeout
+ * @note       with drdy_read linked the function returns as soon as dout/drdy goes low,
+ *             with delay_us linked the wait is the conversion time plus 10%,
+ *             otherwise the delay_ms table is used
+ */
+static uint8_t a_ads1118_wait_conversion(ads1118_handle_t *handle, ads1118_rate_t rate)
+{
+    uint32_t t;
+    
+    t = gs_conversion_us[rate & 0x07];                                    /* get conversion time */
+    if ((handle->drdy_read != NULL) || (handle->drdy_read_ctx != NULL))   /* poll drdy */
+    {
+        return a_ads1118_poll_drdy(handle, t);                            /* wait drdy */
+    }
+    if (handle->delay_us != NULL)                                         /* if delay_us is linked */
+    {
+        a_ads1118_delay_us(handle, t + t / 10);                           /* conversion time + 10% */
+        
+        return 0;                                                         /* success return 0 */
+    }
+    
+    switch (rate)                                                         /* choose the rate */
+    {
+        case 0 :                                                          /* 8sps */
+        {
+            a_ads1118_delay_ms(handle, 138);                              /* > ((1000 / 8) *(1 + 10%)) */
+            
+            break;                                                        /* break */
+        }
+        case 1 :                                                          /* 16sps */
+        {
+            a_ads1118_delay_ms(handle, 69);                               /* > ((1000 / 16) *(1 + 10%)) */
+            
+            break;                                                        /* break */
+        }
+        case 2 :                                                          /* 32sps */
+        {
+            a_ads1118_delay_ms(handle, 35);                               /* > ((1000 / 32) *(1 + 10%)) */
+            
+            break;                                                        /* break */
+        }
+        case 3 :                                                          /* 64sps */
+        {
+            a_ads1118_delay_ms(handle, 18);                               /* > ((1000 / 64) *(1 + 10%)) */
+            
+            break;                                                        /* break */
+        }
+        case 4 :                                                          /* 128sps */
+        {
+            a_ads1118_delay_ms(handle, 9);                                /* > ((1000 / 128) *(1 + 10%)) */
+            
+            break;                                                        /* break */
+        }
+        case 5 :                                                          /* 250sps */
+        {
+            a_ads1118_delay_ms(handle, 5);                                /* > ((1000 / 250) *(1 + 10%)) */
+            
+            break;                                                        /* break */
+        }
+        case 6 :                                                          /* 475sps */
+        {
+            a_ads1118_delay_ms(handle, 3);                                /* > ((1000 / 475) *(1 + 10%)) */
+            
+            break;                                                        /* break */
+        }
+        case 7 :                                                          /* 860sps */
+        {
+            a_ads1118_delay_ms(handle, 2);                                /* > ((1000 / 860) *(1 + 10%)) */
+            
+            break;                                                        /* break */
+        }
+        default :
+        {
+            a_ads1118_delay_ms(handle, 200);                              /* 200ms */
+            
+            break;                                                        /* break */
+        }
+    }
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief conversion rate definition
+ */
+static const uint32_t gs_rate_sps[8] =
+{
+    8, 16, 32, 64, 128, 250, 475, 860,                          /* conversions per second */
+};
+
+/**
+ * @brief     track the cadence of a continuous result
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] level dout/drdy level before the data read, 0 is low, 1 is high and 2 is unknown
+ * @note      conversion k ends at cont_start + k / sps,
+ *            dout/drdy wins over the cadence and a high level pulls the cadence back in phase
+ */
+static void a_ads1118_continuous_track(ads1118_handle_t *handle, uint8_t level)
+{
+    uint64_t k;
+    uint64_t n;
+    
+    k = handle->cont_index + 1;                                                           /* one conversion by default */
+    if ((handle->get_time_us != NULL) && (handle->data_time >= handle->cont_start))       /* if the cadence is known */
+    {
+        k = ((handle->data_time - handle->cont_start) *
+             gs_rate_sps[(handle->conf >> 5) & 0x07]) / 1000000;                          /* ended conversions */
+    }
+    n = (k > handle->cont_index) ? (k - handle->cont_index) : 0;                          /* new conversions */
+    if (level == 1)                                                                       /* no new data */
+    {
+        if (n != 0)                                                                       /* the cadence runs ahead */
+        {
+            handle->cont_index = k;                                                       /* pull it back */
+        }
+        n = 0;                                                                            /* duplicate */
+    }
+    else if ((level == 0) && (n == 0))                                                    /* the cadence runs behind */
+    {
+        n = 1;                                                                            /* one new data at least */
+    }
+    handle->cont_index += n;                                                              /* move the index */
+    if (n == 0)                                                                           /* no new conversion */
+    {
+        handle->cont_status = ADS1118_CONTINUOUS_STATUS_DUPLICATE;                        /* set duplicate */
+        handle->cont_skipped = 0;                                                         /* nothing missed */
+        handle->cont_count.duplicate++;                                                   /* count the duplicate */
+    }
+    else
+    {
+        handle->cont_status = (n > 1) ? ADS1118_CONTINUOUS_STATUS_SKIPPED :
+                              ADS1118_CONTINUOUS_STATUS_FRESH;                            /* set fresh or skipped */
+        handle->cont_skipped = (uint32_t)(n - 1);                                         /* set missed conversions */
+        handle->cont_count.fresh++;                                                       /* count the fresh result */
+        handle->cont_count.skipped += (uint32_t)(n - 1);                                  /* count the missed conversions */
+    }
+}
+
+/**
+ * @brief      check if a new continuous result is ready
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *ready pointer to a ready flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 drdy read failed
+ * @note       dout/drdy is read if it is linked, otherwise the cadence is used,
+ *             with neither of them linked the result is always ready
+ */
+static uint8_t a_ads1118_continuous_ready(ads1118_handle_t *handle, uint8_t *ready)
+{
+    uint8_t level;
+    uint64_t k;
+    
+    *ready = 1;                                                                           /* ready by default */
+    if ((handle->drdy_read != NULL) || (handle->drdy_read_ctx != NULL))                   /* if drdy is linked */
+    {
+        STATS_ADD(handle, drdy_reads, 1);                                                 /* count the drdy read */
+        if (a_ads1118_drdy_read(handle, &level) != 0)                                     /* read drdy */
+        {
+            handle->debug_print("ads1118: drdy read failed.\n");                          /* drdy read failed */
+            STATS_ERROR(handle);                                                          /* count the api error */
+            
+            return 1;                                                                     /* return error */
+        }
+        *ready = (level == 0) ? 1 : 0;                                                    /* low is new data */
+    }
+    else if (handle->get_time_us != NULL)                                                 /* if the cadence is known */
+    {
+        k = ((a_ads1118_get_time_us(handle) - handle->cont_start) *
+             gs_rate_sps[(handle->conf >> 5) & 0x07]) / 1000000;                          /* ended conversions */
+        *ready = (k > handle->cont_index) ? 1 : 0;                                        /* a conversion ended after the last result */
+    }
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      read a continuous result and track its cadence
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *raw pointer to a raw adc buffer
+ * @param[in]  waited 1 if dout/drdy has just been polled low
+ * @param[in]  next config of the next conversion
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       without waited dout/drdy is read once before the data if it is linked,
+ *             a next config other than the current one is written in the same frame as the read
+ *             and restarts the cadence
+ */
+static uint8_t a_ads1118_continuous_fetch(ads1118_handle_t *handle, int16_t *raw, uint8_t waited,
+                                          uint16_t next)
+{
+    uint8_t level;
+    
+    level = 2;                                                                            /* unknown level */
+    if ((handle->drdy_read != NULL) || (handle->drdy_read_ctx != NULL))                   /* if drdy is linked */
+    {
+        if (waited != 0)                                                                  /* drdy is polled low */
+        {
+            level = 0;                                                                    /* new data */
+        }
+        else
+        {
+            STATS_ADD(handle, drdy_reads, 1);                                             /* count the drdy read */
+            if (a_ads1118_drdy_read(handle, &level) != 0)                                 /* read drdy */
+            {
+                handle->debug_print("ads1118: drdy read failed.\n");                      /* drdy read failed */
+                STATS_ERROR(handle);                                                      /* count the api error */
+                
+                return 1;                                                                 /* return error */
+            }
+            level = (level != 0) ? 1 : 0;                                                 /* high is no new data */
+        }
+    }
+    if (next != handle->conf)                                                             /* if the config changes */
+    {
+        if (a_ads1118_spi_write_read_data(handle, next, raw) != 0)                        /* write the config and read data */
+        {
+            return 1;                                                                     /* return error */
+        }
+        a_ads1118_continuous_track(handle, level);                                        /* track the cadence */
+        handle->conf = next;                                                              /* save config */
+        handle->cont_start = handle->data_time;                                           /* restart the cadence */
+        handle->cont_index = 0;                                                           /* no conversion ended */
+        
+        return 0;                                                                         /* success return 0 */
+    }
+    if (a_ads1118_spi_read_data(handle, raw) != 0)                                        /* read data */
+    {
+        return 1;                                                                         /* return error */
+    }
+    a_ads1118_continuous_track(handle, level);                                            /* track the cadence */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief microvolt scale definition
+ * @note  one lsb is fsr / 32768 uV, which is 375 >> 1 for 6.144V and 125 >> n for the other ranges
+ */
+static const uint16_t gs_uv_mul[6] = {375, 125, 125, 125, 125, 125};
+static const uint8_t gs_uv_shift[6] = {1, 0, 1, 2, 3, 4};
+
+/**
+ * @brief lsb in volt definition
+ * @note  dividing by 32768 is exact in float, so raw * lsb matches raw * fsr / 32768 bit by bit
+ */
+static const float gs_lsb_v[6] =
+{
+    6.144f / 32768.0f, 4.096f / 32768.0f, 2.048f / 32768.0f,
+    1.024f / 32768.0f, 0.512f / 32768.0f, 0.256f / 32768.0f,
+};
+
+/**
+ * @brief      scale raw data
+ * @param[in]  *raw pointer to a raw adc buffer
+ * @param[out] *out pointer to a converted buffer
+ * @param[in]  n buffer length
+ * @param[in]  lsb value of one lsb
+ * @note       the tail loop is written to be auto vectorized when no simd variant is built
+ */
+static void a_ads1118_scale_n(const int16_t *raw, float *out, uint32_t n, float lsb)
+{
+    uint32_t i = 0;
+    
+#if defined(ADS1118_SIMD_SSE2)
+    __m128 k = _mm_set1_ps(lsb);                                             /* set the lsb */
+    
+    for (; (i + 8) <= n; i += 8)                                             /* 8 samples per loop */
+    {
+        __m128i x = _mm_loadu_si128((const __m128i *)&raw[i]);               /* load 8 samples */
+        __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);           /* sign extend the low half */
+        __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16);           /* sign extend the high half */
+        
+        _mm_storeu_ps(&out[i], _mm_mul_ps(_mm_cvtepi32_ps(lo), k));          /* convert the low half */
+        _mm_storeu_ps(&out[i + 4], _mm_mul_ps(_mm_cvtepi32_ps(hi), k));      /* convert the high half */
+    }
+#elif defined(ADS1118_SIMD_NEON)
+    for (; (i + 8) <= n; i += 8)                                             /* 8 samples per loop */
+    {
+        int16x8_t x = vld1q_s16(&raw[i]);                                    /* load 8 samples */
+        int32x4_t lo = vmovl_s16(vget_low_s16(x));                           /* sign extend the low half */
+        int32x4_t hi = vmovl_s16(vget_high_s16(x));                          /* sign extend the high half */
+        
+        vst1q_f32(&out[i], vmulq_n_f32(vcvtq_f32_s32(lo), lsb));             /* convert the low half */
+        vst1q_f32(&out[i + 4], vmulq_n_f32(vcvtq_f32_s32(hi), lsb));         /* convert the high half */
+    }
+#endif
+    for (; i < n; i++)                                                       /* the other samples */
+    {
+        out[i] = (float)raw[i] * lsb;                                        /* convert */
+    }
+}
+
+/**
+ * @brief      convert the raw data to the voltage
+ * @param[in]  range adc range
+ * @param[in]  raw adc raw data
+ * @param[out] *v pointer to a converted adc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 range is invalid
+ * @note       v can be NULL to only check the range
+ */
+static uint8_t a_ads1118_convert_voltage(ads1118_range_t range, int16_t raw, float *v)
+{
+    if (range > ADS1118_RANGE_0P256V)                                     /* check range */
+    {
+        return 1;                                                         /* return error */
+    }
+    if (v == NULL)                                                        /* check v */
+    {
+        return 0;                                                         /* skip the float conversion */
+    }
+    
+    if (range == ADS1118_RANGE_6P144V)                                    /* if 6.144V */
+    {
+        *v = (float)(raw) * 6.144f / 32768.0f;                            /* get convert adc */
+    }
+    else if (range == ADS1118_RANGE_4P096V)                               /* if 4.096V */
+    {
+        *v = (float)(raw) * 4.096f / 32768.0f;                            /* get convert adc */
+    }
+    else if (range == ADS1118_RANGE_2P048V)                               /* if 2.048V */
+    {
+        *v = (float)(raw) * 2.048f / 32768.0f;                            /* get convert adc */
+    }
+    else if (range == ADS1118_RANGE_1P024V)                               /* if 1.024V */
+    {
+        *v = (float)(raw) * 1.024f / 32768.0f;                            /* get convert adc */
+    }
+    else if (range == ADS1118_RANGE_0P512V)                               /* if 0.512V */
+    {
+        *v = (float)(raw) * 0.512f / 32768.0f;                            /* get convert adc */
+    }
+    else if (range == ADS1118_RANGE_0P256V)                               /* if 0.256V */
+    {
+        *v = (float)(raw) * 0.256f / 32768.0f;                            /* get convert adc */
+    }
+    else
+    {
+        return 1;                                                         /* return error */
+    }
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief     correct a raw data with the integer calibration
+ * @param[in] offset offset code
+ * @param[in] gain q15 gain
+ * @param[in] raw adc raw data
+ * @return    corrected raw data
+ * @note      the difference is saturated to 16 bits first,
+ *            so the product with the q15 gain fits in 32 bits
+ */
+static int16_t a_ads1118_calibrate_code(int32_t offset, int32_t gain, int16_t raw)
+{
+    int32_t d;
+    int32_t p;
+    int32_t m;
+    
+    d = (int32_t)raw - offset;                                                        /* remove the offset */
+    d = (d > 32767) ? 32767 : d;                                                      /* saturate the max */
+    d = (d < -32768) ? -32768 : d;                                                    /* saturate the min */
+    p = d * gain;                                                                     /* apply the gain */
+    m = (p < 0) ? -p : p;                                                             /* get the magnitude */
+    m = (m + 16384) >> 15;                                                            /* round half away from zero */
+    p = (p < 0) ? -m : m;                                                             /* put the sign back */
+    p = (p > 32767) ? 32767 : p;                                                      /* saturate the max */
+    p = (p < -32768) ? -32768 : p;                                                    /* saturate the min */
+    
+    return (int16_t)p;                                                                /* return the code */
+}
+
+/**
+ * @brief      correct a raw data block with the integer calibration
+ * @param[in]  *cal pointer to an ads1118 calibration structure
+ * @param[in]  *raw pointer to a raw adc buffer
+ * @param[out] *out pointer to a corrected raw adc buffer
+ * @param[in]  n buffer length
+ * @note       raw and out can be the same buffer,
+ *             the entry is read once so the loop does not reload it after every store
+ */
+static void a_ads1118_calibrate_n(const ads1118_calibration_t *cal, const int16_t *raw, int16_t *out, uint32_t n)
+{
+    uint32_t i;
+    int32_t offset;
+    int32_t gain;
+    
+    offset = cal->offset;                                                             /* get the offset */
+    gain = cal->gain;                                                                 /* get the gain */
+    for (i = 0; i < n; i++)                                                           /* run all samples */
+    {
+        out[i] = a_ads1118_calibrate_code(offset, gain, raw[i]);                      /* correct */
+    }
+}
+
+/**
+ * @brief      convert a raw data block to the voltage with the float calibration
+ * @param[in]  *cal pointer to an ads1118 calibration structure
+ * @param[in]  *raw pointer to a raw adc buffer
+ * @param[out] *v pointer to a converted adc buffer
+ * @param[in]  n buffer length
+ * @param[in]  lsb value of one lsb
+ * @note       the gain and the lsb are merged into one factor
+ */
+static void a_ads1118_calibrate_volts_n(const ads1118_calibration_t *cal, const int16_t *raw, float *v,
+                                        uint32_t n, float lsb)
+{
+    uint32_t i;
+    int32_t offset;
+    float k;
+    
+    offset = cal->offset;                                                             /* get the offset */
+    k = (float)cal->gain * lsb / 32768.0f;                                            /* merge the gain and the lsb */
+    for (i = 0; i < n; i++)                                                           /* run all samples */
+    {
+        v[i] = (float)((int32_t)raw[i] - offset) * k;                                 /* convert */
+    }
+}
+
+/**
+ * @brief     get the calibration entry of a config
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] conf config of the conversion
+ * @return    pointer to the entry, NULL if the result is not corrected
+ * @note      the temperature mode and a disabled calibration give NULL,
+ *            the range 6 and 7 use the 0.256V entry
+ */
+static const ads1118_calibration_t *a_ads1118_calibration_get(ads1118_handle_t *handle, uint16_t conf)
+{
+    uint8_t range;
+    
+    if ((handle->calibration_enable == 0) || ((conf & (1 << 4)) != 0))                /* check the calibration */
+    {
+        return NULL;                                                                  /* no calibration */
+    }
+    range = (uint8_t)((conf >> 9) & 0x07);                                            /* get range conf */
+    if (range > ADS1118_RANGE_0P256V)                                                 /* 6 and 7 are 0.256V too */
+    {
+        range = ADS1118_RANGE_0P256V;                                                 /* set 0.256V */
+    }
+    
+    return &handle->calibration[(conf >> 12) & 0x07][range];                          /* return the entry */
+}
+
+/**
+ * @brief         correct a result with the integer calibration
+ * @param[in]     *handle pointer to an ads1118 handle structure
+ * @param[in]     conf config of the conversion
+ * @param[in,out] *raw pointer to a raw adc buffer
+ * @note          raw is kept without a calibration entry
+ */
+static void a_ads1118_calibrate_raw(ads1118_handle_t *handle, uint16_t conf, int16_t *raw)
+{
+    const ads1118_calibration_t *cal;
+    
+    cal = a_ads1118_calibration_get(handle, conf);                                    /* get the entry */
+    if (cal != NULL)                                                                  /* check the entry */
+    {
+        *raw = a_ads1118_calibrate_code(cal->offset, cal->gain, *raw);                /* correct the code */
+    }
+}
+
+/**
+ * @brief         convert a result to the voltage with the calibration
+ * @param[in]     *handle pointer to an ads1118 handle structure
+ * @param[in]     conf config of the conversion
+ * @param[in,out] *raw pointer to a raw adc buffer
+ * @param[out]    *v pointer to a converted buffer, can be NULL
+ * @return        status code
+ *                - 0 success
+ *                - 1 range is invalid
+ * @note          v gets the float correction of the chip code and raw the integer correction,
+ *                both are left ideal without a calibration entry
+ */
+static uint8_t a_ads1118_calibrate_convert(ads1118_handle_t *handle, uint16_t conf, int16_t *raw, float *v)
+{
+    uint8_t range;
+    const ads1118_calibration_t *cal;
+    
+    range = (uint8_t)((conf >> 9) & 0x07);                                            /* get range conf */
+    cal = a_ads1118_calibration_get(handle, conf);                                    /* get the entry */
+    if ((cal == NULL) || (range > ADS1118_RANGE_0P256V))                              /* check the entry */
+    {
+        return a_ads1118_convert_voltage((ads1118_range_t)range, *raw, v);            /* convert */
+    }
+    if (v != NULL)                                                                    /* check v */
+    {
+        a_ads1118_calibrate_volts_n(cal, raw, v, 1, gs_lsb_v[range]);                 /* convert with the calibration */
+    }
+    *raw = a_ads1118_calibrate_code(cal->offset, cal->gain, *raw);                    /* correct the code */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief         convert a result with the config of its conversion
+ * @param[in]     *handle pointer to an ads1118 handle structure
+ * @param[in]     conf config of the conversion
+ * @param[in,out] *raw pointer to a raw adc buffer
+ * @param[out]    *v pointer to a converted buffer, can be NULL
+ * @return        status code
+ *                - 0 success
+ *                - 1 range is invalid
+ * @note          the temperature mode gives the temperature
+ */
+static uint8_t a_ads1118_result_convert(ads1118_handle_t *handle, uint16_t conf, int16_t *raw, float *v)
+{
+    if ((conf & (1 << 4)) != 0)                                                       /* if temperature mode */
+    {
+        if (v != NULL)                                                                /* check v */
+        {
+            *v = (float)(*raw) * 0.03125f / 4.0f;                                     /* convert to deg */
+        }
+        
+        return 0;                                                                     /* success return 0 */
+    }
+    
+    return a_ads1118_calibrate_convert(handle, conf, raw, v);                         /* convert */
+}
+
+/**
+ * @brief      read the config register
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *conf pointer to a config buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the single shot bit is cleared and the nop bits are set valid,
+ *             so the result can be written back as it is
+ */
+static uint8_t a_ads1118_read_config(ads1118_handle_t *handle, uint16_t *conf)
+{
+    uint16_t data;
+    
+    if (a_ads1118_spi_read(handle, (uint16_t *)&data) != 0)        /* read config */
+    {
+        return 1;                                                  /* return error */
+    }
+    data &= ~(1 << 15);                                            /* clear single shot bit */
+    data &= ~(3 << 1);                                             /* clear nop */
+    data |= COMMAND_VALID;                                         /* set command valid */
+    handle->chip_mode = (uint8_t)((data >> 8) & 0x01);             /* the chip holds the mode */
+    *conf = data;                                                  /* set config */
+    
+    return 0;                                                      /* success return 0 */
+}
+
+/**
+ * @brief     initialize the chip
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 spi initialization failed
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 read config failed
+ * @note      none
+ */
+uint8_t ads1118_init(ads1118_handle_t *handle)
+{
+    uint8_t i;
+    uint8_t j;
+    uint16_t conf;
+    
+    if (handle == NULL)                                              /* check handle */
+    {
+        return 2;                                                    /* return error */
+    }
+    if (handle->debug_print == NULL)                                 /* check debug_print */
+    {
+        return 3;                                                    /* return error */
+    }
+    if ((handle->spi_init == NULL) &&
+        (handle->spi_init_ctx == NULL))                              /* check spi_init */
+    {
+        handle->debug_print("ads1118: spi_init is null.\n");         /* spi_init is null */
+        
+        return 3;                                                    /* return error */
+    }
+    if ((handle->spi_deinit == NULL) &&
+        (handle->spi_deinit_ctx == NULL))                            /* check spi_deinit */
+    {
+        handle->debug_print("ads1118: spi_deinit is null.\n");       /* spi_deinit is null */
+        
+        return 3;                                                    /* return error */
+    }
+    if ((handle->spi_transmit == NULL) &&
+        (handle->spi_transmit_ctx == NULL))                          /* check spi_transmit */
+    {
+        handle->debug_print("ads1118: spi_transmit is null.\n");     /* spi_transmit is null */
+        
+        return 3;                                                    /* return error */
+    }
+    if (handle->delay_ms == NULL)                                    /* check delay_ms */
+    {
+        handle->debug_print("ads1118: delay_ms is null.\n");         /* delay_ms is null */
+        
+        return 3;                                                    /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_INIT);                               /* set the running api */
+    if (a_ads1118_spi_init(handle) != 0)                             /* spi init */
+    {
+        handle->debug_print("ads1118: spi init failed.\n");          /* spi init failed */
+        
+        return 1;                                                    /* return error */
+    }
+    if (a_ads1118_read_config(handle, (uint16_t *)&conf) != 0)       /* read config */
+    {
+        handle->debug_print("ads1118: read config failed.\n");       /* read config failed */
+        (void)a_ads1118_spi_deinit(handle);                          /* spi deinit */
+        
+        return 4;                                                    /* return error */
+    }
+    handle->conf = conf;                                             /* init config shadow */
+    handle->batch_len = 0;                                           /* clear queue */
+    handle->batch_enable = 0;                                        /* disable batch mode */
+    handle->single_busy = 0;                                         /* no single conversion */
+    handle->fetch_pending = 0;                                       /* no convert and fetch conversion */
+    handle->cont_status = ADS1118_CONTINUOUS_STATUS_FRESH;           /* no continuous result */
+    handle->cont_skipped = 0;                                        /* nothing missed */
+    handle->cont_count.fresh = 0;                                    /* clear fresh count */
+    handle->cont_count.duplicate = 0;                                /* clear duplicate count */
+    handle->cont_count.skipped = 0;                                  /* clear skipped count */
+    handle->autorange_enable = 0;                                    /* disable the auto range */
+    for (i = 0; i < 8; i++)                                          /* all channels */
+    {
+        for (j = 0; j < 6; j++)                                      /* all ranges */
+        {
+            handle->calibration[i][j].offset = 0;                    /* no offset */
+            handle->calibration[i][j].gain = 32768;                  /* unity gain */
+        }
+    }
+    handle->calibration_enable = 0;                                  /* disable the calibration */
+    handle->inited = 1;                                              /* flag inited */
+    
+    return 0;                                                        /* success return 0 */
+}
+
+/**
+ * @brief     close the chip
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 spi deinit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 power down failed
+ * @note      none
+ */
+uint8_t ads1118_deinit(ads1118_handle_t *handle)
+{
+    uint8_t res;
+    uint16_t conf;
+    
+    if (handle == NULL)                                                /* check handle */
+    {
+        return 2;                                                      /* return error */
+    }
+    if (handle->inited != 1)                                           /* check handle initialization */
+    {
+        return 3;                                                      /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_DEINIT);                               /* set the running api */
+    handle->batch_enable = 0;                                          /* leave batch mode */
+    conf = handle->conf;                                               /* get config */
+    conf &= ~(0x01 << 8);                                              /* clear bit */
+    conf |= 1 << 8;                                                    /* set stop continues read */
+    res = a_ads1118_spi_write(handle, conf);                           /* write config */
+    if (res != 0)                                                      /* check error */
+    {
+        handle->debug_print("ads1118: write config failed.\n");        /* write config failed */
+        
+        return 4;                                                      /* return error */
+    }
+    handle->conf = conf;                                               /* save config */
+    res = a_ads1118_spi_deinit(handle);                                /* close spi */
+    if (res != 0)                                                      /* check the result */
+    {
+        handle->debug_print("ads1118: spi deinit failed.\n");          /* spi deinit failed */
+        
+        return 1;                                                      /* return error */
+    }
+    handle->inited = 0;                                                /* flag close */
+    
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief     set the adc channel
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] channel adc channel
+ * @return    status code
+ *            - 0 success
+ *            - 1 set channel failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ads1118_set_channel(ads1118_handle_t *handle, ads1118_channel_t channel)
+{
+    uint8_t res;
+    uint16_t conf;
+    
+    if (handle == NULL)                                                /* check handle */
+    {
+        return 2;                                                      /* return error */
+    }
+    if (handle->inited != 1)                                           /* check handle initialization */
+    {
+        return 3;                                                      /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_SET_CHANNEL);                          /* set the running api */
+    conf = handle->conf;                                               /* get config */
+    conf &= ~(0x07 << 12);                                             /* clear channel */
+    conf |= (channel & 0x07) << 12;                                    /* set channel */
+    conf &= ~(3 << 1);                                                 /* clear nop */
+    conf |= COMMAND_VALID;                                             /* set command valid */
+    res = a_ads1118_spi_write(handle, conf);                           /* write config */
+    if (res != 0)                                                      /* check error */
+    {
+        handle->debug_print("ads1118: write config failed.\n");        /* write config failed */
+        
+        return 1;                                                      /* return error */
+    }
+    handle->conf = conf;                                               /* save config */
+    
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief      get the adc channel
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *channel pointer to a channel buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get channel failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ads1118_get_channel(ads1118_handle_t *handle, ads1118_channel_t *channel)
+{
+    if (handle == NULL)                                               /* check handle */
+    {
+        return 2;                                                     /* return error */
+    }
+    if (handle->inited != 1)                                          /* check handle initialization */
+    {
+        return 3;                                                     /* return error */
+    }
+    
+    *channel = (ads1118_channel_t)((handle->conf >> 12) & 0x07);      /* get channel */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief     set the adc range
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] range adc max voltage range
  * @return    status code
  *            - 0 success
  *            - 1 set range failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      none
+ */
+uint8_t ads1118_set_range(ads1118_handle_t *handle, ads1118_range_t range)
+{
+    uint8_t res;
+    uint16_t conf;
+    
+    if (handle == NULL)                                                /* check handle */
+    {
+        return 2;                                                      /* return error */
+    }
+    if (handle->inited != 1)                                           /* check handle initialization */
+    {
+        return 3;                                                      /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_SET_RANGE);                            /* set the running api */
+    conf = handle->conf;                                               /* get config */
+    conf &= ~(0x07 << 9);                                              /* clear range */
+    conf |= (range & 0x07) << 9;                                       /* set range */
+    conf &= ~(3 << 1);                                                 /* clear nop */
+    conf |= COMMAND_VALID;                                             /* set command valid */
+    res = a_ads1118_spi_write(handle, conf);                           /* write config */
+    if (res != 0)                                                      /* check error */
+    {
+        handle->debug_print("ads1118: write config failed.\n");        /* write config failed */
+        
+        return 1;                                                      /* return error */
+    }
+    handle->conf = conf;                                               /* save config */
+    
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief      get the adc range
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *range pointer to a voltage range buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get range failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ads1118_get_range(ads1118_handle_t *handle, ads1118_range_t *range)
+{
+    if (handle == NULL)                                               /* check handle */
+    {
+        return 2;                                                     /* return error */
+    }
+    if (handle->inited != 1)                                          /* check handle initialization */
+    {
+        return 3;                                                     /* return error */
+    }
+    
+    *range = (ads1118_range_t)((handle->conf >> 9) & 0x07);           /* get range */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief     enable or disable the auto range
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      enabling starts every channel at the current range,
+ *            single read, single start, scan and continuous read pick the channel range
+ *            and step it after every result, the range change rides on the config write of the frame,
+ *            continuous read block, the filter read and the bus service keep the configured range
+ */
+uint8_t ads1118_set_autorange(ads1118_handle_t *handle, ads1118_bool_t enable)
+{
+    uint8_t i;
+    uint8_t range;
+    
+    if (handle == NULL)                                           /* check handle */
+    {
+        return 2;                                                 /* return error */
+    }
+    if (handle->inited != 1)                                      /* check handle initialization */
+    {
+        return 3;                                                 /* return error */
+    }
+    
+    if ((enable != 0) && (handle->autorange_enable == 0))         /* if the auto range starts */
+    {
+        range = (uint8_t)((handle->conf >> 9) & 0x07);            /* get range conf */
+        if (range > ADS1118_RANGE_0P256V)                         /* 6 and 7 are 0.256V too */
+        {
+            range = ADS1118_RANGE_0P256V;                         /* set 0.256V */
+        }
+        for (i = 0; i < 8; i++)                                   /* set all channels */
+        {
+            handle->autorange[i] = range;                         /* start at the current range */
+        }
+    }
+    handle->autorange_enable = (uint8_t)((enable != 0) ? 1 : 0);  /* set the auto range flag */
+    
+    return 0;                                                     /* success return 0 */
+}
+
+/**
+ * @brief      get the auto range status
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ads1118_get_autorange(ads1118_handle_t *handle, ads1118_bool_t *enable)
+{
+    if (handle == NULL)                                               /* check handle */
+    {
+        return 2;                                                     /* return error */
+    }
+    if (handle->inited != 1)                                          /* check handle initialization */
+    {
+        return 3;                                                     /* return error */
+    }
+    
+    *enable = (ads1118_bool_t)(handle->autorange_enable);             /* get the auto range flag */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief     set the auto range of a channel
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] channel adc channel
+ * @param[in] range adc max voltage range
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 range is invalid
+ * @note      use it to seed a channel with a known signal level
+ */
+uint8_t ads1118_set_autorange_range(ads1118_handle_t *handle, ads1118_channel_t channel, ads1118_range_t range)
+{
+    if (handle == NULL)                                               /* check handle */
+    {
+        return 2;                                                     /* return error */
+    }
+    if (handle->inited != 1)                                          /* check handle initialization */
+    {
+        return 3;                                                     /* return error */
+    }
+    
+    if (range > ADS1118_RANGE_0P256V)                                 /* check range */
+    {
+        handle->debug_print("ads1118: range is invalid.\n");          /* range is invalid */
+        
+        return 4;                                                     /* return error */
+    }
+    
+    handle->autorange[channel & 0x07] = (uint8_t)range;               /* set the channel range */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief      get the auto range of a channel
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  channel adc channel
+ * @param[out] *range pointer to a voltage range buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ads1118_get_autorange_range(ads1118_handle_t *handle, ads1118_channel_t channel, ads1118_range_t *range)
+{
+    if (handle == NULL)                                               /* check handle */
+    {
+        return 2;                                                     /* return error */
+    }
+    if (handle->inited != 1)                                          /* check handle initialization */
+    {
+        return 3;                                                     /* return error */
+    }
+    
+    *range = (ads1118_range_t)handle->autorange[channel & 0x07];      /* get the channel range */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief     set the sample rate
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] rate adc sample rate
+ * @return    status code
+ *            - 0 success
+ *            - 1 set rate failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ads1118_set_rate(ads1118_handle_t *handle, ads1118_rate_t rate)
+{
+    uint8_t res;
+    uint16_t conf;
+    
+    if (handle == NULL)                                                /* check handle */
+    {
+        return 2;                                                      /* return error */
+    }
+    if (handle->inited != 1)                                           /* check handle initialization */
+    {
+        return 3;                                                      /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_SET_RATE);                             /* set the running api */
+    conf = handle->conf;                                               /* get config */
+    conf &= ~(0x07 << 5);                                              /* clear rate */
+    conf |= (rate & 0x07) << 5;                                        /* set rate */
+    conf &= ~(3 << 1);                                                 /* clear nop */
+    conf |= COMMAND_VALID;                                             /* set command valid */
+    res = a_ads1118_spi_write(handle, conf);                           /* write config */
+    if (res != 0)                                                      /* check error */
+    {
+        handle->debug_print("ads1118: write config failed.\n");        /* write config failed */
+        
+        return 1;                                                      /* return error */
+    }
+    handle->conf = conf;                                               /* save config */
+    
+    return 0;                                                          /* success return */
+}
+
+/**
+ * @brief      get the sample rate
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *rate pointer to an adc sample rate buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get rate failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ads1118_get_rate(ads1118_handle_t *handle, ads1118_rate_t *rate)
+{
+    if (handle == NULL)                                               /* check handle */
+    {
+        return 2;                                                     /* return error */
+    }
+    if (handle->inited != 1)                                          /* check handle initialization */
+    {
+        return 3;                                                     /* return error */
+    }
+    
+    *rate = (ads1118_rate_t)((handle->conf >> 5) & 0x07);             /* get rate */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief     set the chip mode
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] mode chip mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 set mode failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ads1118_set_mode(ads1118_handle_t *handle, ads1118_mode_t mode)
+{
+    uint8_t res;
+    uint16_t conf;
+    
+    if (handle == NULL)                                                /* check handle */
+    {
+        return 2;                                                      /* return error */
+    }
+    if (handle->inited != 1)                                           /* check handle initialization */
+    {
+        return 3;                                                      /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_SET_MODE);                             /* set the running api */
+    conf = handle->conf;                                               /* get config */
+    conf &= ~(1 << 4);                                                 /* clear settings */
+    conf |= mode << 4;                                                 /* set mode */
+    conf &= ~(3 << 1);                                                 /* clear nop */
+    conf |= COMMAND_VALID;                                             /* set command valid */
+    res = a_ads1118_spi_write(handle, conf);                           /* write config */
+    if (res != 0)                                                      /* check error */
+    {
+        handle->debug_print("ads1118: write config failed.\n");        /* write config failed */
+        
+        return 1;                                                      /* return error */
+    }
+    handle->conf = conf;                                               /* save config */
+    
+    return 0;                                                          /* success return */
+}
+
+/**
+ * @brief      get the chip mode
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *mode pointer to a mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get mode failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ads1118_get_mode(ads1118_handle_t *handle, ads1118_mode_t *mode)
+{
+    if (handle == NULL)                                               /* check handle */
+    {
+        return 2;                                                     /* return error */
+    }
+    if (handle->inited != 1)                                          /* check handle initialization */
+    {
+        return 3;                                                     /* return error */
+    }
+    
+    *mode = (ads1118_mode_t)((handle->conf >> 4) & 0x01);             /* get mode */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief     enable or disable dout pull up
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set dout pull up failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ads1118_set_dout_pull_up(ads1118_handle_t *handle, ads1118_bool_t enable)
+{
+    uint8_t res;
+    uint16_t conf;
+    
+    if (handle == NULL)                                                /* check handle */
+    {
+        return 2;                                                      /* return error */
+    }
+    if (handle->inited != 1)                                           /* check handle initialization */
+    {
+        return 3;                                                      /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_SET_DOUT_PULL_UP);                     /* set the running api */
+    conf = handle->conf;                                               /* get config */
+    conf &= ~(1 << 3);                                                 /* clear settings */
+    conf |= enable << 3;                                               /* set enable */
+    conf &= ~(3 << 1);                                                 /* clear nop */
+    conf |= COMMAND_VALID;                                             /* set command valid */
+    res = a_ads1118_spi_write(handle, conf);                           /* write config */
+    if (res != 0)                                                      /* check error */
+    {
+        handle->debug_print("ads1118: write config failed.\n");        /* write config failed */
+        
+        return 1;                                                      /* return error */
+    }
+    handle->conf = conf;                                               /* save config */
+    
+    return 0;                                                          /* success return */
+}
+
+/**
+ * @brief      get dout pull up status
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get dout pull up failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ads1118_get_dout_pull_up(ads1118_handle_t *handle, ads1118_bool_t *enable)
+{
+    if (handle == NULL)                                                /* check handle */
+    {
+        return 2;                                                      /* return error */
+    }
+    if (handle->inited != 1)                                           /* check handle initialization */
+    {
+        return 3;                                                      /* return error */
+    }
+    
+    *enable = (ads1118_bool_t)((handle->conf >> 3) & 0x01);            /* get bool */
+    
+    return 0;                                                          /* success return */
+}
+
+/**
+ * @brief     reload the config shadow from the chip
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 sync config failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the setters and getters work on the config shadow in the handle,
+ *            run this function if the chip config may be changed outside the driver
+ */
+uint8_t ads1118_sync_config(ads1118_handle_t *handle)
+{
+    uint16_t conf;
+    
+    if (handle == NULL)                                                /* check handle */
+    {
+        return 2;                                                      /* return error */
+    }
+    if (handle->inited != 1)                                           /* check handle initialization */
+    {
+        return 3;                                                      /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_SYNC_CONFIG);                          /* set the running api */
+    if (a_ads1118_read_config(handle, (uint16_t *)&conf) != 0)         /* read config */
+    {
+        handle->debug_print("ads1118: read config failed.\n");         /* read config failed */
+        
+        return 1;                                                      /* return error */
+    }
+    handle->conf = conf;                                               /* save config */
+    
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief      verify the config shadow against the chip
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *match pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 verify config failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the config shadow is not changed, run ads1118_sync_config to reload it
+ */
+uint8_t ads1118_verify_config(ads1118_handle_t *handle, ads1118_bool_t *match)
+{
+    uint16_t conf;
+    
+    if (handle == NULL)                                                      /* check handle */
+    {
+        return 2;                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                 /* check handle initialization */
+    {
+        return 3;                                                            /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_VERIFY_CONFIG);                              /* set the running api */
+    if (a_ads1118_read_config(handle, (uint16_t *)&conf) != 0)               /* read config */
+    {
+        handle->debug_print("ads1118: read config failed.\n");               /* read config failed */
+        
+        return 1;                                                            /* return error */
+    }
+    if ((conf & CONFIG_MASK) == (handle->conf & CONFIG_MASK))                /* check settings */
+    {
+        *match = ADS1118_BOOL_TRUE;                                          /* match */
+    }
+    else
+    {
+        *match = ADS1118_BOOL_FALSE;                                         /* mismatch */
+    }
+    
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief     enter the batch mode
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      config writes and ads1118_transmit frames are queued until ads1118_batch_end,
+ *            any read, conversion start or mode change sends the queue first,
+ *            a queued config write directly before another one is replaced by it
+ */
+uint8_t ads1118_batch_begin(ads1118_handle_t *handle)
+{
+    if (handle == NULL)                   /* check handle */
+    {
+        return 2;                         /* return error */
+    }
+    if (handle->inited != 1)              /* check handle initialization */
+    {
+        return 3;                         /* return error */
+    }
+    
+    handle->batch_enable = 1;             /* enable batch mode */
+    
+    return 0;                             /* success return 0 */
+}
+
+/**
+ * @brief     send the queued frames and leave the batch mode
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 batch transmit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the rx buffers of the queued ads1118_transmit frames are valid after this function
+ */
+uint8_t ads1118_batch_end(ads1118_handle_t *handle)
+{
+    if (handle == NULL)                                                /* check handle */
+    {
+        return 2;                                                      /* return error */
+    }
+    if (handle->inited != 1)                                           /* check handle initialization */
+    {
+        return 3;                                                      /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_BATCH_END);                            /* set the running api */
+    handle->batch_enable = 0;                                          /* disable batch mode */
+    if (a_ads1118_batch_flush(handle) != 0)                            /* send the queue */
+    {
+        handle->debug_print("ads1118: batch transmit failed.\n");      /* batch transmit failed */
+        
+        return 1;                                                      /* return error */
+    }
+    
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief      get the hot path counters
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *stats pointer to an ads1118 stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 4 stats is disabled
+ * @note       the counters are only compiled in with ADS1118_STATS_ENABLE set to 1,
+ *             they are kept across ads1118_init and ads1118_deinit
+ */
+uint8_t ads1118_get_stats(ads1118_handle_t *handle, ads1118_stats_t *stats)
+{
+    if (handle == NULL)                                         /* check handle */
+    {
+        return 2;                                               /* return error */
+    }
+    
+#if (ADS1118_STATS_ENABLE != 0)
+    memcpy(stats, &handle->stats, sizeof(ads1118_stats_t));     /* copy the counters */
+    
+    return 0;                                                   /* success return 0 */
+#else
+    (void)stats;                                                /* not used */
+    
+    return 4;                                                   /* return error */
+#endif
+}
+
+/**
+ * @brief     clear the hot path counters
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 stats is disabled
+ * @note      none
+ */
+uint8_t ads1118_clear_stats(ads1118_handle_t *handle)
+{
+    if (handle == NULL)                                         /* check handle */
+    {
+        return 2;                                               /* return error */
+    }
+    
+#if (ADS1118_STATS_ENABLE != 0)
+    memset(&handle->stats, 0, sizeof(ads1118_stats_t));         /* clear the counters */
+    
+    return 0;                                                   /* success return 0 */
+#else
+    return 4;                                                   /* return error */
+#endif
+}
+
+/**
+ * @brief     enable or disable the spi trace
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 trace is disabled
+ * @note      the trace is only compiled in with ADS1118_TRACE_ENABLE set to 1,
+ *            enabling the trace clears the old entries
+ */
+uint8_t ads1118_set_trace(ads1118_handle_t *handle, ads1118_bool_t enable)
+{
+    if (handle == NULL)                                   /* check handle */
+    {
+        return 2;                                         /* return error */
+    }
+    
+#if (ADS1118_TRACE_ENABLE != 0)
+    if (enable == ADS1118_BOOL_TRUE)                      /* enable */
+    {
+        handle->trace_seq = 0;                            /* clear the old entries */
+    }
+    handle->trace_enable = (uint8_t)enable;               /* set the trace flag */
+    
+    return 0;                                             /* success return 0 */
+#else
+    (void)enable;                                         /* not used */
+    
+    return 4;                                             /* return error */
+#endif
+}
+
+/**
+ * @brief         get the spi trace
+ * @param[in]     *handle pointer to an ads1118 handle structure
+ * @param[out]    *entry pointer to a trace buffer
+ * @param[in,out] *len pointer to a length buffer
+ * @return        status code
+ *                - 0 success
+ *                - 2 handle is NULL
+ *                - 4 trace is disabled
+ * @note          len is the buffer size in and the copied entry number out,
+ *                the newest entries are copied from the oldest one to the newest one
+ */
+uint8_t ads1118_get_trace(ads1118_handle_t *handle, ads1118_trace_t *entry, uint32_t *len)
+{
+#if (ADS1118_TRACE_ENABLE != 0)
+    uint32_t i;
+    uint32_t n;
+    uint32_t start;
+#endif
+    
+    if (handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    
+#if (ADS1118_TRACE_ENABLE != 0)
+    n = handle->trace_seq;                                                       /* get the entry number */
+    if (n > ADS1118_TRACE_DEPTH)                                                 /* check the ring size */
+    {
+        n = ADS1118_TRACE_DEPTH;                                                 /* only the ring is kept */
+    }
+    if (n > *len)                                                                /* check the buffer size */
+    {
+        n = *len;                                                                /* keep the newest ones */
+    }
+    start = handle->trace_seq - n;                                               /* get the first entry */
+    for (i = 0; i < n; i++)                                                      /* copy all entries */
+    {
+        entry[i] = handle->trace[(start + i) & (ADS1118_TRACE_DEPTH - 1)];       /* copy the entry */
+    }
+    *len = n;                                                                    /* set the entry number */
+    
+    return 0;                                                                    /* success return 0 */
+#else
+    (void)entry;                                                                 /* not used */
+    *len = 0;                                                                    /* no entry */
+    
+    return 4;                                                                    /* return error */
+#endif
+}
+
+/**
+ * @brief     print the spi trace
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 trace is disabled
+ * @note      one "ads1118: trace" line is printed with debug_print for every entry from the oldest one,
+ *            the host decoder of the simulator project turns the lines into a timeline
+ */
+uint8_t ads1118_trace_dump(ads1118_handle_t *handle)
+{
+#if (ADS1118_TRACE_ENABLE != 0)
+    uint32_t i;
+    uint32_t n;
+    ads1118_trace_t *e;
+#endif
+    
+    if (handle == NULL)                                                                 /* check handle */
+    {
+        return 2;                                                                       /* return error */
+    }
+    
+#if (ADS1118_TRACE_ENABLE != 0)
+    n = handle->trace_seq;                                                              /* get the entry number */
+    if (n > ADS1118_TRACE_DEPTH)                                                        /* check the ring size */
+    {
+        n = ADS1118_TRACE_DEPTH;                                                        /* only the ring is kept */
+    }
+    for (i = handle->trace_seq - n; i != handle->trace_seq; i++)                        /* print all entries */
+    {
+        e = &handle->trace[i & (ADS1118_TRACE_DEPTH - 1)];                              /* get the entry */
+        handle->debug_print("ads1118: trace %lu %08lX%08lX %lu %u %u %u %u "
+                            "%02X%02X%02X%02X %02X%02X%02X%02X\n",
+                            (unsigned long)e->seq,
+                            (unsigned long)(e->timestamp >> 32),
+                            (unsigned long)(e->timestamp & 0xFFFFFFFFUL),
+                            (unsigned long)e->duration,
+                            e->type, e->api, e->res, e->len,
+                            e->tx[0], e->tx[1], e->tx[2], e->tx[3],
+                            e->rx[0], e->rx[1], e->rx[2], e->rx[3]);                    /* print the entry */
+    }
+    
+    return 0;                                                                           /* success return 0 */
+#else
+    return 4;                                                                           /* return error */
+#endif
+}
+
+/**
+ * @brief      read data from the chip once
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *raw pointer to a raw adc buffer
+ * @param[out] *v pointer to a converted adc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       v can be NULL to skip the float conversion
+ */
+uint8_t ads1118_single_read(ads1118_handle_t *handle, int16_t *raw, float *v)
+{
+    uint8_t res;
+    uint8_t rate;
+    uint16_t conf;
+    
+    if (handle == NULL)                                                   /* check handle */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (handle->inited != 1)                                              /* check handle initialization */
+    {
+        return 3;                                                         /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_SINGLE_READ);                             /* set the running api */
+    conf = a_ads1118_autorange_conf(handle, handle->conf);                /* get config with the auto range */
+    conf &= ~(1 << 8);                                                    /* clear bit */
+    conf |= 1 << 8;                                                       /* set single read */
+    res = a_ads1118_spi_write(handle, conf | (1 << 15));                  /* start single read */
+    if (res != 0)                                                         /* check error */
+    {
+        handle->debug_print("ads1118: write config failed.\n");           /* write config failed */
+        
+        return 1;                                                         /* return error */
+    }
+    handle->conf = conf;                                                  /* save config */
+    rate = (ads1118_rate_t)((conf >> 5) & 0x07);                          /* get rate conf */
+    res = a_ads1118_wait_conversion(handle, (ads1118_rate_t)rate);        /* wait conversion */
+    if (res != 0)                                                         /* check the result */
+    {
+        return 1;                                                         /* return error */
+    }
+    res = a_ads1118_spi_read_data(handle, raw);                           /* read data */
+    if (res != 0)                                                         /* check the result */
+    {
+        handle->debug_print("ads1118: continues read failed.\n");         /* continues read failed */
+        
+        return 1;                                                         /* return error */
+    }
+    a_ads1118_autorange_update(handle, conf, *raw);                       /* update the auto range */
+    if (a_ads1118_calibrate_convert(handle, conf, raw, v) != 0)           /* convert */
+    {
+        handle->debug_print("ads1118: range is invalid.\n");              /* range is invalid */
+        
+        return 1;                                                         /* return error */
+    }
+    STATS_ADD(handle, samples, 1);                                        /* count the samples */
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief      read a timestamped sample from the chip once
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *sample pointer to a sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the timestamp is the get_time_us time of the data read frame,
+ *             so it is the end of the conversion within the drdy poll or delay step,
+ *             the timestamp is 0 if get_time_us is not linked
+ */
+uint8_t ads1118_single_read_sample(ads1118_handle_t *handle, ads1118_sample_t *sample)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                               /* check handle */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (handle->inited != 1)                                                          /* check handle initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    res = ads1118_single_read(handle, &sample->raw, NULL);                            /* read once */
+    if (res != 0)                                                                     /* check the result */
+    {
+        return 1;                                                                     /* return error */
+    }
+    a_ads1118_sample_tag(handle, handle->conf, sample);                               /* fill the sample */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      start a single conversion without waiting
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *ready_us pointer to a ready time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single start failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       ready_us is the get_time_us time when the result is ready with the conversion time + 10%,
+ *             it is the time from now if get_time_us is not linked,
+ *             do not change the config before ads1118_single_fetch
+ */
+uint8_t ads1118_single_start(ads1118_handle_t *handle, uint64_t *ready_us)
+{
+    uint8_t res;
+    uint32_t t;
+    uint16_t conf;
+    
+    if (handle == NULL)                                                                   /* check handle */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (handle->inited != 1)                                                              /* check handle initialization */
+    {
+        return 3;                                                                         /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_SINGLE_ASYNC);                                            /* set the running api */
+    conf = a_ads1118_autorange_conf(handle, handle->conf);                                /* get config with the auto range */
+    conf |= 1 << 8;                                                                       /* set single read */
+    res = a_ads1118_spi_write(handle, conf | (1 << 15));                                  /* start single read */
+    if (res != 0)                                                                         /* check error */
+    {
+        handle->debug_print("ads1118: write config failed.\n");                           /* write config failed */
+        
+        return 1;                                                                         /* return error */
+    }
+    handle->conf = conf;                                                                  /* save config */
+    t = gs_conversion_us[(conf >> 5) & 0x07];                                             /* get conversion time */
+    handle->single_deadline = a_ads1118_get_time_us(handle) + t + t / 10;                 /* conversion time + 10% */
+    handle->single_busy = 1;                                                              /* flag started */
+    *ready_us = handle->single_deadline;                                                  /* set the ready time */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      check whether the started single conversion is finished
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *ready pointer to a ready buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single is ready failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 no conversion is started
+ *             - 5 neither drdy nor get_time_us is linked
+ * @note       it never waits, dout/drdy is read if drdy is linked,
+ *             otherwise the ready time of ads1118_single_start is compared with get_time_us,
+ *             a drdy which stays high past the ready time + margin is a conversion timeout,
+ *             which drops the conversion so ads1118_single_fetch returns 4
+ */
+uint8_t ads1118_single_is_ready(ads1118_handle_t *handle, ads1118_bool_t *ready)
+{
+    uint8_t level;
+    
+    if (handle == NULL)                                                                   /* check handle */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (handle->inited != 1)                                                              /* check handle initialization */
+    {
+        return 3;                                                                         /* return error */
+    }
+    if (handle->single_busy == 0)                                                         /* check the conversion */
+    {
+        handle->debug_print("ads1118: no conversion is started.\n");                      /* no conversion is started */
+        
+        return 4;                                                                         /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_SINGLE_ASYNC);                                            /* set the running api */
+    if ((handle->drdy_read != NULL) || (handle->drdy_read_ctx != NULL))                   /* check drdy */
+    {
+        STATS_ADD(handle, drdy_reads, 1);                                                 /* count the drdy read */
+        if (a_ads1118_drdy_read(handle, (uint8_t *)&level) != 0)                          /* read drdy */
+        {
+            handle->debug_print("ads1118: drdy read failed.\n");                          /* drdy read failed */
+            STATS_ERROR(handle);                                                          /* count the api error */
+            
+            return 1;                                                                     /* return error */
+        }
+        if ((level != 0) && (handle->get_time_us != NULL) &&
+            (a_ads1118_get_time_us(handle) > handle->single_deadline + DRDY_TIMEOUT_US))  /* check timeout */
+        {
+            handle->debug_print("ads1118: conversion timeout.\n");                        /* conversion timeout */
+            STATS_ERROR(handle);                                                          /* count the api error */
+            handle->single_busy = 0;                                                      /* drop the conversion */
+            
+            return 1;                                                                     /* return error */
+        }
+        *ready = (level == 0) ? ADS1118_BOOL_TRUE : ADS1118_BOOL_FALSE;                   /* low is ready */
+    }
+    else if (handle->get_time_us != NULL)                                                 /* check the deadline */
+    {
+        *ready = (a_ads1118_get_time_us(handle) >= handle->single_deadline) ?
+                 ADS1118_BOOL_TRUE : ADS1118_BOOL_FALSE;                                  /* ready after the deadline */
+    }
+    else
+    {
+        handle->debug_print("ads1118: neither drdy nor get_time_us is linked.\n");        /* no ready source */
+        
+        return 5;                                                                         /* return error */
+    }
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      fetch the result of the started single conversion
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *raw pointer to a raw adc buffer
+ * @param[out] *v pointer to a converted adc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single fetch failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 no conversion is started
+ * @note       call it after ads1118_single_is_ready returns true,
+ *             v can be NULL to skip the float conversion
+ */
+uint8_t ads1118_single_fetch(ads1118_handle_t *handle, int16_t *raw, float *v)
+{
+    if (handle == NULL)                                                                   /* check handle */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (handle->inited != 1)                                                              /* check handle initialization */
+    {
+        return 3;                                                                         /* return error */
+    }
+    if (handle->single_busy == 0)                                                         /* check the conversion */
+    {
+        handle->debug_print("ads1118: no conversion is started.\n");                      /* no conversion is started */
+        
+        return 4;                                                                         /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_SINGLE_ASYNC);                                            /* set the running api */
+    if (a_ads1118_spi_read_data(handle, raw) != 0)                                        /* read data */
+    {
+        handle->debug_print("ads1118: read data failed.\n");                              /* read data failed */
+        
+        return 1;                                                                         /* return error */
+    }
+    handle->single_busy = 0;                                                              /* the result is fetched */
+    a_ads1118_autorange_update(handle, handle->conf, *raw);                               /* update the auto range */
+    if (a_ads1118_calibrate_convert(handle, handle->conf, raw, v) != 0)                   /* convert */
+    {
+        handle->debug_print("ads1118: range is invalid.\n");                              /* range is invalid */
+        
+        return 1;                                                                         /* return error */
+    }
+    STATS_ADD(handle, samples, 1);                                                        /* count the samples */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      start a conversion and fetch the previous result in one transmission
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  *next pointer to the slot of the conversion to start
+ * @param[out] *prev_raw pointer to a raw adc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 convert and fetch failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the chip is set to the single shot mode and the slot config is kept in the config shadow,
+ *             prev_raw is the result of the conversion started by the last call,
+ *             prev_raw is corrected with the entry of its slot if the calibration is enabled,
+ *             the first call of a pipeline returns a stale result which is neither corrected nor counted as a sample,
+ *             any other frame between two calls starts a new pipeline,
+ *             wait the conversion time of the slot before the next call
+ */
+uint8_t ads1118_convert_and_fetch(ads1118_handle_t *handle, const ads1118_slot_t *next, int16_t *prev_raw)
+{
+    uint8_t res;
+    uint8_t pending;
+    uint16_t conf;
+    
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_CONVERT_AND_FETCH);                                /* set the running api */
+    conf = a_ads1118_slot_config(handle->conf, next);                              /* make slot config */
+    pending = handle->fetch_pending;                                               /* save the pipeline state */
+    res = a_ads1118_spi_write_read_data(handle, conf | (1 << 15), prev_raw);       /* start single read */
+    if (res != 0)                                                                  /* check error */
+    {
+        handle->debug_print("ads1118: convert and fetch failed.\n");               /* convert and fetch failed */
+        
+        return 1;                                                                  /* return error */
+    }
+    if (pending != 0)                                                              /* prev_raw is a started slot */
+    {
+        a_ads1118_calibrate_raw(handle, handle->conf, prev_raw);                   /* correct the code */
+        STATS_ADD(handle, samples, 1);                                             /* count the samples */
+    }
+    handle->conf = conf;                                                           /* save config */
+    handle->fetch_pending = 1;                                                     /* flag started */
+    
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief      scan a list of slots
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  *slot pointer to a slot list
+ * @param[in]  len slot list length
+ * @param[out] *raw pointer to a raw adc buffer
+ * @param[out] *v pointer to a converted adc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 scan failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 len is invalid
+ * @note       each transmission starts the next slot while reading the last one,
+ *             so a scan of len slots takes len + 1 transmissions,
+ *             v is the voltage in the adc mode and the temperature in the temperature mode,
+ *             v can be NULL to skip the float conversion
+ */
+uint8_t ads1118_scan(ads1118_handle_t *handle, const ads1118_slot_t *slot, uint8_t len,
+                     int16_t *raw, float *v)
+{
+    uint8_t res;
+    uint8_t i;
+    int16_t prev;
+    uint16_t conf;
+    
+    if (handle == NULL)                                                              /* check handle */
+    {
+        return 2;                                                                    /* return error */
+    }
+    if (handle->inited != 1)                                                         /* check handle initialization */
+    {
+        return 3;                                                                    /* return error */
+    }
+    if (len == 0)                                                                    /* check length */
+    {
+        handle->debug_print("ads1118: len is invalid.\n");                           /* len is invalid */
+        
+        return 4;                                                                    /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_SCAN);                                               /* set the running api */
+    for (i = 0; i < len; i++)                                                        /* run all slots */
+    {
+        conf = a_ads1118_slot_config(handle->conf, &slot[i]);                        /* make slot config */
+        conf = a_ads1118_autorange_conf(handle, conf);                               /* set the auto range */
+        res = a_ads1118_spi_write_read_data(handle, conf | (1 << 15), &prev);        /* start the slot */
+        if (res != 0)                                                                /* check error */
+        {
+            handle->debug_print("ads1118: convert and fetch failed.\n");             /* convert and fetch failed */
+            
+            return 1;                                                                /* return error */
+        }
+        if (i != 0)                                                                  /* skip the first result */
+        {
+            raw[i - 1] = prev;                                                       /* save the last slot */
+            a_ads1118_autorange_update(handle, handle->conf, prev);                  /* update the auto range */
+            if (a_ads1118_result_convert(handle, handle->conf, &raw[i - 1],
+                                         (v != NULL) ? &v[i - 1] : NULL) != 0)       /* convert during the conversion */
+            {
+                handle->debug_print("ads1118: range is invalid.\n");                 /* range is invalid */
+                
+                return 1;                                                            /* return error */
+            }
+        }
+        handle->conf = conf;                                                         /* save config */
+        res = a_ads1118_wait_conversion(handle, slot[i].rate);                       /* wait conversion */
+        if (res != 0)                                                                /* check the result */
+        {
+            return 1;                                                                /* return error */
+        }
+    }
+    res = a_ads1118_spi_read_data(handle, &raw[len - 1]);                            /* read the last slot */
+    if (res != 0)                                                                    /* check error */
+    {
+        handle->debug_print("ads1118: read data failed.\n");                         /* read data failed */
+        
+        return 1;                                                                    /* return error */
+    }
+    a_ads1118_autorange_update(handle, handle->conf, raw[len - 1]);                  /* update the auto range */
+    if (a_ads1118_result_convert(handle, handle->conf, &raw[len - 1],
+                                 (v != NULL) ? &v[len - 1] : NULL) != 0)             /* convert */
+    {
+        handle->debug_print("ads1118: range is invalid.\n");                         /* range is invalid */
+        
+        return 1;                                                                    /* return error */
+    }
+    STATS_ADD(handle, samples, len);                                                 /* count the samples */
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief      scan a list of slots into timestamped samples
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  *slot pointer to a slot list
+ * @param[in]  len slot list length
+ * @param[out] *sample pointer to a sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 scan failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 len is invalid
+ * @note       the transmissions are the same as ads1118_scan,
+ *             every timestamp is the get_time_us time of the frame which fetched the slot result
+ */
+uint8_t ads1118_scan_sample(ads1118_handle_t *handle, const ads1118_slot_t *slot, uint8_t len,
+                            ads1118_sample_t *sample)
+{
+    uint8_t res;
+    uint8_t i;
+    int16_t prev;
+    uint16_t conf;
+    
+    if (handle == NULL)                                                               /* check handle */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (handle->inited != 1)                                                          /* check handle initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    if (len == 0)                                                                     /* check length */
+    {
+        handle->debug_print("ads1118: len is invalid.\n");                            /* len is invalid */
+        
+        return 4;                                                                     /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_SCAN);                                                /* set the running api */
+    for (i = 0; i < len; i++)                                                         /* run all slots */
+    {
+        conf = a_ads1118_slot_config(handle->conf, &slot[i]);                         /* make slot config */
+        conf = a_ads1118_autorange_conf(handle, conf);                                /* set the auto range */
+        res = a_ads1118_spi_write_read_data(handle, conf | (1 << 15), &prev);         /* start the slot */
+        if (res != 0)                                                                 /* check error */
+        {
+            handle->debug_print("ads1118: convert and fetch failed.\n");              /* convert and fetch failed */
+            
+            return 1;                                                                 /* return error */
+        }
+        if (i != 0)                                                                   /* skip the first result */
+        {
+            sample[i - 1].raw = prev;                                                 /* save the last slot */
+            a_ads1118_sample_tag(handle, handle->conf, &sample[i - 1]);               /* fill the sample */
+            a_ads1118_autorange_update(handle, handle->conf, prev);                   /* update the auto range */
+            a_ads1118_calibrate_raw(handle, handle->conf, &sample[i - 1].raw);        /* correct the code */
+        }
+        handle->conf = conf;                                                          /* save config */
+        res = a_ads1118_wait_conversion(handle, slot[i].rate);                        /* wait conversion */
+        if (res != 0)                                                                 /* check the result */
+        {
+            return 1;                                                                 /* return error */
+        }
+    }
+    res = a_ads1118_spi_read_data(handle, &sample[len - 1].raw);                      /* read the last slot */
+    if (res != 0)                                                                     /* check error */
+    {
+        handle->debug_print("ads1118: read data failed.\n");                          /* read data failed */
+        
+        return 1;                                                                     /* return error */
+    }
+    a_ads1118_sample_tag(handle, handle->conf, &sample[len - 1]);                     /* fill the sample */
+    a_ads1118_autorange_update(handle, handle->conf, sample[len - 1].raw);            /* update the auto range */
+    a_ads1118_calibrate_raw(handle, handle->conf, &sample[len - 1].raw);              /* correct the code */
+    STATS_ADD(handle, samples, len);                                                  /* count the samples */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      read data from the chip continuously
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *raw pointer to a raw adc buffer
+ * @param[out] *v pointer to a converted adc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 continuous read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       this function can be used only after run ads1118_start_continuous_read
+ *             and can be stopped by ads1118_stop_continuous_read,
+ *             v can be NULL to skip the float conversion
+ */
+uint8_t ads1118_continuous_read(ads1118_handle_t *handle, int16_t *raw, float *v)
+{
+    uint8_t res;
+    uint16_t conf;
+    uint16_t next;
+    
+    if (handle == NULL)                                                   /* check handle */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (handle->inited != 1)                                              /* check handle initialization */
+    {
+        return 3;                                                         /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_CONTINUOUS_READ);                         /* set the running api */
+    conf = handle->conf;                                                  /* get config */
+    next = a_ads1118_autorange_conf(handle, conf);                        /* get the next config */
+    res = a_ads1118_continuous_fetch(handle, raw, 0, next);               /* read data */
+    if (res != 0)                                                         /* check error */
+    {
+        handle->debug_print("ads1118: continuous read failed.\n");        /* continuous read failed */
+        
+        return 1;                                                         /* return error */
+    }
+    a_ads1118_autorange_update(handle, conf, *raw);                       /* update the auto range */
+    if (a_ads1118_calibrate_convert(handle, conf, raw, v) != 0)           /* convert */
+    {
+        handle->debug_print("ads1118: range is invalid.\n");              /* range is invalid */
+        
+        return 1;                                                         /* return error */
+    }
+    STATS_ADD(handle, samples, 1);                                        /* count the samples */
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief      read a block of data from the chip continuously
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *raw pointer to a raw adc buffer
+ * @param[out] *v pointer to a converted adc buffer
+ * @param[in]  len buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 continuous read block failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 len is invalid
+ * @note       this function can be used only after run ads1118_start_continuous_read,
+ *             the samples are paced by dout/drdy or the data period and converted after the last one,
+ *             v can be NULL to skip the float conversion
+ */
+uint8_t ads1118_continuous_read_block(ads1118_handle_t *handle, int16_t *raw, float *v, uint16_t len)
+{
+    uint8_t res;
+    uint16_t i;
+    ads1118_range_t range;
+    ads1118_rate_t rate;
+    const ads1118_calibration_t *cal;
+    
+    if (handle == NULL)                                                   /* check handle */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (handle->inited != 1)                                              /* check handle initialization */
+    {
+        return 3;                                                         /* return error */
+    }
+    if (len == 0)                                                         /* check length */
+    {
+        handle->debug_print("ads1118: len is invalid.\n");                /* len is invalid */
+        
+        return 4;                                                         /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_CONTINUOUS_READ);                         /* set the running api */
+    range = (ads1118_range_t)((handle->conf >> 9) & 0x07);                /* get range conf */
+    rate = (ads1118_rate_t)((handle->conf >> 5) & 0x07);                  /* get rate conf */
+    for (i = 0; i < len; i++)                                             /* read all samples */
+    {
+        if (i != 0)                                                       /* not the first sample */
+        {
+            res = a_ads1118_wait_period(handle, rate);                    /* wait the next sample */
+            if (res != 0)                                                 /* check the result */
+            {
+                return 1;                                                 /* return error */
+            }
+        }
+        res = a_ads1118_continuous_fetch(handle, &raw[i], (i != 0) ? 1 : 0,
+                                         handle->conf);                   /* read data */
+        if (res != 0)                                                     /* check error */
+        {
+            handle->debug_print("ads1118: continuous read failed.\n");    /* continuous read failed */
+            
+            return 1;                                                     /* return error */
+        }
+    }
+    if (range > ADS1118_RANGE_0P256V)                                     /* check range */
+    {
+        handle->debug_print("ads1118: range is invalid.\n");              /* range is invalid */
+        
+        return 1;                                                         /* return error */
+    }
+    cal = a_ads1118_calibration_get(handle, handle->conf);                /* get the entry */
+    if (cal != NULL)                                                      /* if calibrated */
+    {
+        if (v != NULL)                                                    /* check v */
+        {
+            a_ads1118_calibrate_volts_n(cal, raw, v, len,
+                                        gs_lsb_v[range]);                 /* convert with the calibration */
+        }
+        a_ads1118_calibrate_n(cal, raw, raw, len);                        /* correct all codes */
+    }
+    else if (v != NULL)                                                   /* check v */
+    {
+        (void)ads1118_raw_to_volts_n(range, raw, v, len);                 /* convert all samples */
+    }
+    STATS_ADD(handle, samples, len);                                      /* count the samples */
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief      read timestamped samples from the chip continuously
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *sample pointer to a sample buffer
+ * @param[in]  len buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 continuous read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 len is invalid
+ * @note       this function can be used only after run ads1118_start_continuous_read,
+ *             the first sample is read at once and the others are paced by dout/drdy or the data period,
+ *             every timestamp is the get_time_us time of its data read frame
+ */
+uint8_t ads1118_continuous_read_sample(ads1118_handle_t *handle, ads1118_sample_t *sample, uint16_t len)
+{
+    uint8_t res;
+    uint16_t i;
+    ads1118_rate_t rate;
+    
+    if (handle == NULL)                                                               /* check handle */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (handle->inited != 1)                                                          /* check handle initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    if (len == 0)                                                                     /* check length */
+    {
+        handle->debug_print("ads1118: len is invalid.\n");                            /* len is invalid */
+        
+        return 4;                                                                     /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_CONTINUOUS_READ);                                     /* set the running api */
+    rate = (ads1118_rate_t)((handle->conf >> 5) & 0x07);                              /* get rate conf */
+    for (i = 0; i < len; i++)                                                         /* read all samples */
+    {
+        if (i != 0)                                                                   /* not the first sample */
+        {
+            res = a_ads1118_wait_period(handle, rate);                                /* wait the next sample */
+            if (res != 0)                                                             /* check the result */
+            {
+                return 1;                                                             /* return error */
+            }
+        }
+        res = a_ads1118_continuous_fetch(handle, &sample[i].raw, (i != 0) ? 1 : 0,
+                                         handle->conf);                               /* read data */
+        if (res != 0)                                                                 /* check error */
+        {
+            handle->debug_print("ads1118: continuous read failed.\n");                /* continuous read failed */
+            
+            return 1;                                                                 /* return error */
+        }
+        a_ads1118_sample_tag(handle, handle->conf, &sample[i]);                       /* fill the sample */
+        sample[i].status = handle->cont_status;                                       /* set the status */
+        sample[i].skipped = (handle->cont_skipped > 255) ? 255 :
+                            (uint8_t)handle->cont_skipped;                            /* set missed conversions */
+        a_ads1118_calibrate_raw(handle, handle->conf, &sample[i].raw);                /* correct the code */
+    }
+    STATS_ADD(handle, samples, len);                                                  /* count the samples */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      read decimated data from the chip continuously
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  *filter pointer to an ads1118 filter structure
+ * @param[out] *out pointer to a filter output buffer
+ * @param[in]  len buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 continuous read filter failed
+ *             - 2 handle or filter is NULL
+ *             - 3 handle or filter is not initialized
+ *             - 4 len is invalid
+ * @note       this function can be used only after run ads1118_start_continuous_read,
+ *             len * ratio conversions are read in blocks of 32 and paced by dout/drdy or the data period,
+ *             a result is only read once dout/drdy or the cadence says it is new,
+ *             duplicate results are dropped, the filter state is kept between the calls
+ */
+uint8_t ads1118_continuous_read_filter(ads1118_handle_t *handle, ads1118_filter_t *filter, int32_t *out, uint16_t len)
+{
+    uint8_t res;
+    uint8_t wait;
+    uint16_t done;
+    uint32_t i;
+    uint32_t m;
+    uint32_t n;
+    int16_t raw[32];
+    ads1118_rate_t rate;
+    const ads1118_calibration_t *cal;
+    
+    if ((handle == NULL) || (filter == NULL))                                               /* check handle and filter */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if ((handle->inited != 1) || (filter->inited != 1))                                     /* check initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+    if (len == 0)                                                                           /* check length */
+    {
+        handle->debug_print("ads1118: len is invalid.\n");                                  /* len is invalid */
+        
+        return 4;                                                                           /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_CONTINUOUS_READ);                                           /* set the running api */
+    rate = (ads1118_rate_t)((handle->conf >> 5) & 0x07);                                    /* get rate conf */
+    cal = a_ads1118_calibration_get(handle, handle->conf);                                  /* get the entry */
+    res = a_ads1118_continuous_ready(handle, &wait);                                        /* check the first result */
+    if (res != 0)                                                                           /* check the result */
+    {
+        return 1;                                                                           /* return error */
+    }
+    wait = (wait != 0) ? 0 : 1;                                                             /* wait if it is not ready */
+    done = 0;                                                                               /* no output */
+    while (done < len)                                                                      /* run all outputs */
+    {
+        m = (uint32_t)(len - done) * filter->ratio - filter->phase;                         /* inputs to the last output */
+        if (m > 32)                                                                         /* limit to the block */
+        {
+            m = 32;                                                                         /* set the block */
+        }
+        for (i = 0; i < m; i++)                                                             /* read the block */
+        {
+            while (1)                                                                       /* skip the duplicates */
+            {
+                if (wait != 0)                                                              /* no new result yet */
+                {
+                    res = a_ads1118_wait_period(handle, rate);                              /* wait the next sample */
+                    if (res != 0)                                                           /* check the result */
+                    {
+                        return 1;                                                           /* return error */
+                    }
+                }
+                res = a_ads1118_continuous_fetch(handle, &raw[i], 1, handle->conf);         /* read data */
+                if (res != 0)                                                               /* check error */
+                {
+                    handle->debug_print("ads1118: continuous read failed.\n");              /* continuous read failed */
+                    
+                    return 1;                                                               /* return error */
+                }
+                wait = 1;                                                                   /* wait from now on */
+                if (handle->cont_status != ADS1118_CONTINUOUS_STATUS_DUPLICATE)             /* check new data */
+                {
+                    break;                                                                  /* break */
+                }
+            }
+        }
+        if (cal != NULL)                                                                    /* if calibrated */
+        {
+            a_ads1118_calibrate_n(cal, raw, raw, m);                                        /* correct the block */
+        }
+        (void)ads1118_filter_process(filter, raw, m, &out[done], &n);                       /* filter the block */
+        done = (uint16_t)(done + n);                                                        /* count the outputs */
+    }
+    STATS_ADD(handle, samples, len);                                                        /* count the samples */
+    
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     start the chip reading
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start continuous read failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ads1118_start_continuous_read(ads1118_handle_t *handle)
+{
+    uint8_t res;
+    uint16_t conf;
+    
+    if (handle == NULL)                                                /* check handle */
+    {
+        return 2;                                                      /* return error */
+    }
+    if (handle->inited != 1)                                           /* check handle initialization */
+    {
+        return 3;                                                      /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_START_CONTINUOUS_READ);                /* set the running api */
+    conf = handle->conf;                                               /* get config */
+    conf &= ~(0x01 << 8);                                              /* set start continuous read */
+    handle->cont_start = a_ads1118_get_time_us(handle);                /* conversions start with the write */
+    res = a_ads1118_spi_write(handle, conf);                           /* write config */
+    if (res != 0)                                                      /* check error */
+    {
+        handle->debug_print("ads1118: write config failed.\n");        /* write config failed */
+        
+        return 1;                                                      /* return error */
+    }
+    handle->conf = conf;                                               /* save config */
+    handle->cont_index = 0;                                            /* no conversion yet */
+    
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief     stop the chip reading
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop continuous read failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ads1118_stop_continuous_read(ads1118_handle_t *handle)
+{
+    uint8_t res;
+    uint16_t conf;
+    
+    if (handle == NULL)                                                /* check handle */
+    {
+        return 2;                                                      /* return error */
+    }
+    if (handle->inited != 1)                                           /* check handle initialization */
+    {
+        return 3;                                                      /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_STOP_CONTINUOUS_READ);                 /* set the running api */
+    conf = handle->conf;                                               /* get config */
+    conf &= ~(0x01 << 8);                                              /* clear bit */
+    conf |= 1 << 8;                                                    /* set stop continues read */
+    res = a_ads1118_spi_write(handle, conf);                           /* write config */
+    if (res != 0)                                                      /* check error */
+    {
+        handle->debug_print("ads1118: write config failed.\n");        /* write config failed */
+        
+        return 1;                                                      /* return error */
+    }
+    handle->conf = conf;                                               /* save config */
+    
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief      get the status of the last continuous result
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *status pointer to a continuous status buffer
+ * @param[out] *skipped pointer to a missed conversion number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       with drdy_read linked dout/drdy decides fresh or duplicate,
+ *             with get_time_us linked the conversion cadence from ads1118_start_continuous_read
+ *             at the configured rate counts the missed conversions and decides fresh or duplicate without drdy,
+ *             with neither of them linked every result is reported fresh
+ */
+uint8_t ads1118_get_continuous_status(ads1118_handle_t *handle, ads1118_continuous_status_t *status, uint32_t *skipped)
+{
+    if (handle == NULL)                                               /* check handle */
+    {
+        return 2;                                                     /* return error */
+    }
+    if (handle->inited != 1)                                          /* check handle initialization */
+    {
+        return 3;                                                     /* return error */
+    }
+    
+    *status = (ads1118_continuous_status_t)(handle->cont_status);     /* get status */
+    *skipped = handle->cont_skipped;                                  /* get missed conversions */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief      get the cumulative continuous counts
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *count pointer to an ads1118 continuous count structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the counts are cleared by ads1118_init and ads1118_clear_continuous_count,
+ *             fresh / (fresh + skipped) is the share of the conversions delivered to the caller
+ */
+uint8_t ads1118_get_continuous_count(ads1118_handle_t *handle, ads1118_continuous_count_t *count)
+{
+    if (handle == NULL)                                               /* check handle */
+    {
+        return 2;                                                     /* return error */
+    }
+    if (handle->inited != 1)                                          /* check handle initialization */
+    {
+        return 3;                                                     /* return error */
+    }
+    
+    *count = handle->cont_count;                                      /* copy the counts */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief     clear the cumulative continuous counts
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ads1118_clear_continuous_count(ads1118_handle_t *handle)
+{
+    if (handle == NULL)                                               /* check handle */
+    {
+        return 2;                                                     /* return error */
+    }
+    if (handle->inited != 1)                                          /* check handle initialization */
+    {
+        return 3;                                                     /* return error */
+    }
+    
+    handle->cont_count.fresh = 0;                                     /* clear fresh count */
+    handle->cont_count.duplicate = 0;                                 /* clear duplicate count */
+    handle->cont_count.skipped = 0;                                   /* clear skipped count */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief      temperature convert
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  raw adc raw data
+ * @param[out] *deg pointer to a deg buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ads1118_temperature_convert(ads1118_handle_t *handle, int16_t raw, float *deg)
+{
+    if (handle == NULL)                           /* check handle */
+    {
+        return 2;                                 /* return error */
+    }
+    if (handle->inited != 1)                      /* check handle initialization */
+    {
+        return 3;                                 /* return error */
+    }
+    
+    *deg = (float)(raw) * 0.03125f / 4.0f;        /* convert to deg */
+    
+    return 0;                                     /* success return 0 */
+}
+
+/**
+ * @brief      convert the raw data to microvolts
+ * @param[in]  range adc range
+ * @param[in]  raw adc raw data
+ * @param[out] *uv pointer to a microvolt buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 range is invalid
+ * @note       integer only, the result is raw * fsr / 32768 rounded half away from zero
+ */
+uint8_t ads1118_raw_to_microvolts(ads1118_range_t range, int16_t raw, int32_t *uv)
+{
+    int32_t p;
+    int32_t half;
+    uint8_t shift;
+    
+    if (range > ADS1118_RANGE_0P256V)                         /* check range */
+    {
+        return 1;                                             /* return error */
+    }
+    
+    shift = gs_uv_shift[range];                               /* get shift */
+    half = (int32_t)((1 << shift) >> 1);                      /* get half lsb of the shift */
+    p = (int32_t)raw * (int32_t)gs_uv_mul[range];             /* scale */
+    if (p >= 0)                                               /* if positive */
+    {
+        *uv = (p + half) >> shift;                            /* round up */
+    }
+    else
+    {
+        *uv = -((-p + half) >> shift);                        /* round down */
+    }
+    
+    return 0;                                                 /* success return 0 */
+}
+
+/**
+ * @brief      convert a raw data block to the voltage
+ * @param[in]  range adc range
+ * @param[in]  *raw pointer to a raw adc buffer
+ * @param[out] *v pointer to a converted adc buffer
+ * @param[in]  n buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 range is invalid
+ * @note       the result is the same as the read functions, sse2 or neon is used if the target has it
+ */
+uint8_t ads1118_raw_to_volts_n(ads1118_range_t range, const int16_t *raw, float *v, uint32_t n)
+{
+    if (range > ADS1118_RANGE_0P256V)                    /* check range */
+    {
+        return 1;                                        /* return error */
+    }
+    
+    a_ads1118_scale_n(raw, v, n, gs_lsb_v[range]);       /* convert */
+    
+    return 0;                                            /* success return 0 */
+}
+
+/**
+ * @brief      convert a raw data block to the temperature
+ * @param[in]  *raw pointer to a raw adc buffer
+ * @param[out] *deg pointer to a deg buffer
+ * @param[in]  n buffer length
+ * @return     status code
+ *             - 0 success
+ * @note       the result is the same as ads1118_temperature_convert, sse2 or neon is used if the target has it
+ */
+uint8_t ads1118_raw_to_celsius_n(const int16_t *raw, float *deg, uint32_t n)
+{
+    a_ads1118_scale_n(raw, deg, n, 0.03125f / 4.0f);     /* convert */
+    
+    return 0;                                            /* success return 0 */
+}
+
+/**
+ * @brief     enable or disable the calibration
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      with the calibration enabled single read, single fetch, scan, convert and fetch,
+ *            the bus service and all continuous reads correct the result with the entry of its channel and range,
+ *            raw gets the integer correction and v the float correction of the chip code,
+ *            the temperature mode is not corrected
+ */
+uint8_t ads1118_set_calibration(ads1118_handle_t *handle, ads1118_bool_t enable)
+{
+    if (handle == NULL)                                               /* check handle */
+    {
+        return 2;                                                     /* return error */
+    }
+    if (handle->inited != 1)                                          /* check handle initialization */
+    {
+        return 3;                                                     /* return error */
+    }
+    
+    handle->calibration_enable = (uint8_t)((enable != 0) ? 1 : 0);    /* set the calibration flag */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief      get the calibration status
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ads1118_get_calibration(ads1118_handle_t *handle, ads1118_bool_t *enable)
+{
+    if (handle == NULL)                                               /* check handle */
+    {
+        return 2;                                                     /* return error */
+    }
+    if (handle->inited != 1)                                          /* check handle initialization */
+    {
+        return 3;                                                     /* return error */
+    }
+    
+    *enable = (ads1118_bool_t)(handle->calibration_enable);           /* get the calibration flag */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief     set the calibration of a channel and range
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] channel adc channel
+ * @param[in] range adc range
+ * @param[in] *cal pointer to an ads1118 calibration structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 range is invalid
+ * @note      the corrected code is (raw - offset) * gain / 32768,
+ *            ads1118_init sets every entry to offset 0 and gain 32768
+ */
+uint8_t ads1118_set_calibration_entry(ads1118_handle_t *handle, ads1118_channel_t channel, ads1118_range_t range,
+                                      const ads1118_calibration_t *cal)
+{
+    if (handle == NULL)                                           /* check handle */
+    {
+        return 2;                                                 /* return error */
+    }
+    if (handle->inited != 1)                                      /* check handle initialization */
+    {
+        return 3;                                                 /* return error */
+    }
+    if (range > ADS1118_RANGE_0P256V)                             /* check range */
+    {
+        handle->debug_print("ads1118: range is invalid.\n");      /* range is invalid */
+        
+        return 4;                                                 /* return error */
+    }
+    
+    handle->calibration[channel & 0x07][range] = *cal;            /* set the entry */
+    
+    return 0;                                                     /* success return 0 */
+}
+
+/**
+ * @brief      get the calibration of a channel and range
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  channel adc channel
+ * @param[in]  range adc range
+ * @param[out] *cal pointer to an ads1118 calibration structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is invalid
+ * @note       none
+ */
+uint8_t ads1118_get_calibration_entry(ads1118_handle_t *handle, ads1118_channel_t channel, ads1118_range_t range,
+                                      ads1118_calibration_t *cal)
+{
+    if (handle == NULL)                                           /* check handle */
+    {
+        return 2;                                                 /* return error */
+    }
+    if (handle->inited != 1)                                      /* check handle initialization */
+    {
+        return 3;                                                 /* return error */
+    }
+    if (range > ADS1118_RANGE_0P256V)                             /* check range */
+    {
+        handle->debug_print("ads1118: range is invalid.\n");      /* range is invalid */
+        
+        return 4;                                                 /* return error */
+    }
+    
+    *cal = handle->calibration[channel & 0x07][range];            /* get the entry */
+    
+    return 0;                                                     /* success return 0 */
+}
+
+/**
+ * @brief      capture the offset of a channel and range
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  channel adc channel
+ * @param[in]  range adc range
+ * @param[in]  times averaged conversions
+ * @param[out] *offset pointer to an offset buffer, can be NULL
+ * @return     status code
+ *             - 0 success
+ *             - 1 capture offset failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is invalid
+ *             - 5 times is invalid
+ * @note       the chip mux has no internal short, so the inputs of the channel must be shorted on the board
+ *             or tied to gnd for a single ended channel while it runs,
+ *             the mean of times single shot conversions is saved as the offset of the entry,
+ *             the config is written back at the end, do not run it in the continuous mode
+ */
+uint8_t ads1118_capture_offset(ads1118_handle_t *handle, ads1118_channel_t channel, ads1118_range_t range,
+                               uint16_t times, int16_t *offset)
+{
+    uint8_t res;
+    uint16_t i;
+    uint16_t old;
+    uint16_t conf;
+    int16_t raw;
+    int32_t sum;
+    int32_t mean;
+    
+    if (handle == NULL)                                                                   /* check handle */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (handle->inited != 1)                                                              /* check handle initialization */
+    {
+        return 3;                                                                         /* return error */
+    }
+    if (range > ADS1118_RANGE_0P256V)                                                     /* check range */
+    {
+        handle->debug_print("ads1118: range is invalid.\n");                              /* range is invalid */
+        
+        return 4;                                                                         /* return error */
+    }
+    if (times == 0)                                                                       /* check times */
+    {
+        handle->debug_print("ads1118: times is invalid.\n");                              /* times is invalid */
+        
+        return 5;                                                                         /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_CAPTURE_OFFSET);                                          /* set the running api */
+    old = handle->conf;                                                                   /* save config */
+    conf = old;                                                                           /* get config */
+    conf &= ~(0x07 << 12);                                                                /* clear channel bits */
+    conf |= (uint16_t)((channel & 0x07) << 12);                                           /* set channel */
+    conf &= ~(0x07 << 9);                                                                 /* clear range bits */
+    conf |= (uint16_t)(range << 9);                                                       /* set range */
+    conf &= ~(1 << 4);                                                                    /* set the adc mode */
+    conf |= 1 << 8;                                                                       /* set single read */
+    sum = 0;                                                                              /* init 0 */
+    for (i = 0; i < times; i++)                                                           /* run all conversions */
+    {
+        res = a_ads1118_spi_write(handle, conf | (1 << 15));                              /* start single read */
+        if (res != 0)                                                                     /* check error */
+        {
+            handle->debug_print("ads1118: write config failed.\n");                       /* write config failed */
+            
+            return 1;                                                                     /* return error */
+        }
+        handle->conf = conf;                                                              /* save config */
+        res = a_ads1118_wait_conversion(handle, (ads1118_rate_t)((conf >> 5) & 0x07));    /* wait conversion */
+        if (res != 0)                                                                     /* check the result */
+        {
+            return 1;                                                                     /* return error */
+        }
+        res = a_ads1118_spi_read_data(handle, &raw);                                      /* read data */
+        if (res != 0)                                                                     /* check the result */
+        {
+            handle->debug_print("ads1118: read data failed.\n");                          /* read data failed */
+            
+            return 1;                                                                     /* return error */
+        }
+        sum += raw;                                                                       /* sum the codes */
+    }
+    res = a_ads1118_spi_write(handle, old);                                               /* write back the config */
+    if (res != 0)                                                                         /* check error */
+    {
+        handle->debug_print("ads1118: write config failed.\n");                           /* write config failed */
+        
+        return 1;                                                                         /* return error */
+    }
+    handle->conf = old;                                                                   /* restore config */
+    if (sum >= 0)                                                                         /* if positive */
+    {
+        mean = (sum + (int32_t)(times / 2)) / (int32_t)times;                             /* round up */
+    }
+    else
+    {
+        mean = -((-sum + (int32_t)(times / 2)) / (int32_t)times);                         /* round down */
+    }
+    handle->calibration[channel & 0x07][range].offset = (int16_t)mean;                    /* save the offset */
+    if (offset != NULL)                                                                   /* check offset */
+    {
+        *offset = (int16_t)mean;                                                          /* output the offset */
+    }
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      correct a raw data block with the integer calibration
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  channel adc channel
+ * @param[in]  range adc range
+ * @param[in]  *raw pointer to a raw adc buffer
+ * @param[out] *out pointer to a corrected raw adc buffer
+ * @param[in]  n buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is invalid
+ * @note       raw and out can be the same buffer, the result is rounded half away from zero and saturated,
+ *             the entry is used even with the calibration disabled
+ */
+uint8_t ads1118_calibrate_n(ads1118_handle_t *handle, ads1118_channel_t channel, ads1118_range_t range,
+                            const int16_t *raw, int16_t *out, uint32_t n)
+{
+    if (handle == NULL)                                                               /* check handle */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (handle->inited != 1)                                                          /* check handle initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    if (range > ADS1118_RANGE_0P256V)                                                 /* check range */
+    {
+        handle->debug_print("ads1118: range is invalid.\n");                          /* range is invalid */
+        
+        return 4;                                                                     /* return error */
+    }
+    
+    a_ads1118_calibrate_n(&handle->calibration[channel & 0x07][range], raw, out, n);  /* correct */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      convert a raw data block to the voltage with the float calibration
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  channel adc channel
+ * @param[in]  range adc range
+ * @param[in]  *raw pointer to a raw adc buffer
+ * @param[out] *v pointer to a converted adc buffer
+ * @param[in]  n buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is invalid
+ * @note       the result is (raw - offset) * gain / 32768 * fsr / 32768 without the integer rounding,
+ *             the entry is used even with the calibration disabled
+ */
+uint8_t ads1118_calibrate_to_volts_n(ads1118_handle_t *handle, ads1118_channel_t channel, ads1118_range_t range,
+                                     const int16_t *raw, float *v, uint32_t n)
+{
+    if (handle == NULL)                                                               /* check handle */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (handle->inited != 1)                                                          /* check handle initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    if (range > ADS1118_RANGE_0P256V)                                                 /* check range */
+    {
+        handle->debug_print("ads1118: range is invalid.\n");                          /* range is invalid */
+        
+        return 4;                                                                     /* return error */
+    }
+    
+    a_ads1118_calibrate_volts_n(&handle->calibration[channel & 0x07][range], raw, v,
+                                n, gs_lsb_v[range]);                                  /* convert */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      chip transmit
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  *tx pointer to a tx buffer
+ * @param[out] *rx pointer to a rx buffer
+ * @param[in]  len length of tx and rx buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 transmit failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       in the batch mode the frame is queued and rx is valid after ads1118_batch_end
+ */
+uint8_t ads1118_transmit(ads1118_handle_t *handle, uint8_t *tx, uint8_t *rx, uint16_t len)
+{
+    if (handle == NULL)                                       /* check handle */
+    {
+        return 2;                                             /* return error */
+    }
+    if (handle->inited != 1)                                  /* check handle initialization */
+    {
+        return 3;                                             /* return error */
+    }
+    
+    SET_API(handle, ADS1118_API_TRANSMIT);                    /* set the running api */
+    if (handle->batch_enable != 0)                            /* check batch mode */
+    {
+        return a_ads1118_batch_push(handle, tx, rx, len);     /* queue the frame */
+    }
+    if (a_ads1118_batch_flush(handle) != 0)                   /* send the queued frames first */
+    {
+        return 1;                                             /* return error */
+    }
+    if (a_ads1118_transmit(handle, ADS1118_TRACE_TYPE_TRANSMIT,
+                           tx, rx, len) != 0)                 /* spi transmit */
+    {
+        return 1;                                             /* return error */
+    }
+    
+    return 0;                                                 /* success return 0 */
+}
+
+/**
+ * @brief     fetch the pending result of a device and start its next slot
+ * @param[in] *bus pointer to an ads1118 bus structure
+ * @param[in] i device index
+ * @param[in] *ring pointer to an ads1118 ring structure
+ * @param[in] *samples pointer to a sample counter
+ * @return    status code
+ *            - 0 success
+ *            - 1 convert and fetch failed
+ * @note      the bus must be locked
+ */
+static uint8_t a_ads1118_bus_service(ads1118_bus_t *bus, uint8_t i, ads1118_ring_t *ring, uint32_t *samples)
+{
+    uint32_t t;
+    uint64_t now;
+    int16_t raw;
+    ads1118_bus_device_t *dev;
+    const ads1118_slot_t *slot;
+    ads1118_sample_t sample;
+    
+    dev = &bus->device[i];                                                                /* get device */
+    slot = &dev->slot[dev->cursor];                                                       /* get next slot */
+    if (ads1118_convert_and_fetch(dev->handle, slot, &raw) != 0)                          /* fetch and start */
+    {
+        return 1;                                                                         /* return error */
+    }
+    now = a_ads1118_get_time_us(dev->handle);                                             /* get the start time */
+    if (dev->pending != 0)                                                                /* a result is pending */
+    {
+        sample.timestamp = dev->handle->data_time;                                        /* time of the fetch */
+        sample.raw = raw;                                                                 /* set raw */
+        sample.channel = (uint8_t)dev->slot[dev->pending - 1].channel;                    /* set channel */
+        sample.range = (uint8_t)dev->slot[dev->pending - 1].range;                        /* set range */
+        sample.rate = (uint8_t)dev->slot[dev->pending - 1].rate;                          /* set rate */
+        sample.device = i;                                                                /* set device index */
+        sample.status = ADS1118_CONTINUOUS_STATUS_FRESH;                                  /* new conversion */
+        sample.skipped = 0;                                                               /* nothing missed */
+        if (ring != NULL)                                                                 /* check ring */
+        {
+            (void)ads1118_ring_push(ring, &sample);                                       /* a full ring counts an overrun */
+        }
+        (*samples)++;                                                                     /* count the sample */
+    }
+    t = gs_conversion_us[slot->rate & 0x07];                                              /* get conversion time */
+    dev->pending = dev->cursor + 1;                                                       /* save the started slot */
+    dev->cursor = (uint8_t)((dev->cursor + 1) % dev->slot_len);                           /* next slot */
+    if ((dev->handle->drdy_read != NULL) ||
+        (dev->handle->drdy_read_ctx != NULL))                                             /* check drdy */
+    {
+        dev->deadline = now + t - t / 10;                                                 /* poll drdy from the minimum time */
+    }
+    else
+    {
+        dev->deadline = now + t + t / 10;                                                 /* conversion time + 10% */
+    }
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      service the finished devices until max samples are pushed
+ * @param[in]  *bus pointer to an ads1118 bus structure
+ * @param[in]  *ring pointer to an ads1118 ring structure
+ * @param[in]  max max sample number
+ * @param[out] *samples pointer to a sample number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 poll failed
+ *             - 4 a device has neither drdy nor get_time_us linked
+ * @note       a finished device beyond max is serviced by the next poll
+ */
+static uint8_t a_ads1118_bus_poll(ads1118_bus_t *bus, ads1118_ring_t *ring, uint32_t max, uint32_t *samples)
+{
+    uint8_t i;
+    uint8_t res;
+    uint8_t level;
+    ads1118_bus_device_t *dev;
+    
+    res = 0;                                                                              /* init 0 */
+    *samples = 0;                                                                         /* init 0 */
+    if (bus->lock != NULL)                                                                /* check lock */
+    {
+        bus->lock();                                                                      /* lock the bus */
+    }
+    for (i = 0; i < bus->num; i++)                                                        /* check all devices */
+    {
+        if (*samples >= max)                                                              /* check the sample number */
+        {
+            break;                                                                        /* break */
+        }
+        dev = &bus->device[i];                                                            /* get device */
+        level = 1;                                                                        /* init busy */
+        if (dev->pending == 0)                                                            /* no conversion */
+        {
+            level = 0;                                                                    /* idle devices start at once */
+        }
+        else if ((dev->handle->drdy_read != NULL) ||
+                 (dev->handle->drdy_read_ctx != NULL))                                    /* check drdy */
+        {
+            if ((dev->handle->get_time_us != NULL) &&
+                (a_ads1118_get_time_us(dev->handle) < dev->deadline))                     /* before the minimum time */
+            {
+                continue;                                                                 /* still converting */
+            }
+            STATS_ADD(dev->handle, drdy_reads, 1);                                        /* count the drdy read */
+            if (a_ads1118_drdy_read(dev->handle, (uint8_t *)&level) != 0)                 /* read drdy */
+            {
+                dev->handle->debug_print("ads1118: drdy read failed.\n");                 /* drdy read failed */
+                res = 1;                                                                  /* set error */
+                
+                break;                                                                    /* break */
+            }
+        }
+        else if (dev->handle->get_time_us != NULL)                                        /* check the deadline */
+        {
+            if (a_ads1118_get_time_us(dev->handle) >= dev->deadline)                      /* check the time */
+            {
+                level = 0;                                                                /* the deadline is passed */
+            }
+        }
+        else
+        {
+            res = 4;                                                                      /* set error */
+            
+            break;                                                                        /* break */
+        }
+        if (level == 0)                                                                   /* finished or idle */
+        {
+            if (a_ads1118_bus_service(bus, i, ring, samples) != 0)                        /* fetch and start */
+            {
+                res = 1;                                                                  /* set error */
+                
+                break;                                                                    /* break */
+            }
+        }
+    }
+    if (bus->unlock != NULL)                                                              /* check unlock */
+    {
+        bus->unlock();                                                                    /* unlock the bus */
+    }
+    
+    return res;                                                                           /* return the result */
+}
+
+/**
+ * @brief     initialize the bus manager
+ * @param[in] *bus pointer to an ads1118 bus structure
+ * @param[in] *device pointer to a device list
+ * @param[in] num device number
+ * @return    status code
+ *            - 0 success
+ *            - 2 bus is NULL
+ *            - 4 num is invalid
+ *            - 5 device is invalid
+ * @note      every device needs an initialized handle and at least one slot,
+ *            the chips share one spi bus and every chip has its own cs
  */
-uint8_t ads1118_set_range(ads1118_handle_t *handle, ads1118_range_t range)
+uint8_t ads1118_bus_init(ads1118_bus_t *bus, ads1118_bus_device_t *device, uint8_t num)
+{
+    uint8_t i;
+    
+    if (bus == NULL)                                                        /* check bus */
+    {
+        return 2;                                                           /* return error */
+    }
+    if ((device == NULL) || (num == 0))                                     /* check num */
+    {
+        return 4;                                                           /* return error */
+    }
+    for (i = 0; i < num; i++)                                               /* check all devices */
+    {
+        if ((device[i].handle == NULL) || (device[i].handle->inited != 1) ||
+            (device[i].slot == NULL) || (device[i].slot_len == 0))          /* check device */
+        {
+            return 5;                                                       /* return error */
+        }
+        device[i].cursor = 0;                                               /* start from the first slot */
+        device[i].pending = 0;                                              /* no conversion */
+        device[i].deadline = 0;                                             /* no deadline */
+    }
+    bus->device = device;                                                   /* set device list */
+    bus->num = num;                                                         /* set device number */
+    bus->inited = 1;                                                        /* flag inited */
+    
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief     run one conversion round on all devices
+ * @param[in] *bus pointer to an ads1118 bus structure
+ * @param[in] *ring pointer to an ads1118 ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 round failed
+ *            - 2 bus is NULL
+ *            - 3 bus is not initialized
+ * @note      every device fetches the result of its last slot and starts its next slot in one frame,
+ *            so all chips convert at the same time and the round waits only once for the slowest slot,
+ *            the results of the last round are pushed into the ring with the device index,
+ *            every result is corrected with the calibration of its device handle,
+ *            ring can be NULL to drop the samples
+ */
+uint8_t ads1118_bus_round(ads1118_bus_t *bus, ads1118_ring_t *ring)
+{
+    uint8_t i;
+    uint8_t w;
+    uint32_t t;
+    uint32_t t_max;
+    uint32_t samples;
+    ads1118_bus_device_t *dev;
+    const ads1118_slot_t *slot;
+    
+    if (bus == NULL)                                                                      /* check bus */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (bus->inited != 1)                                                                 /* check bus initialization */
+    {
+        return 3;                                                                         /* return error */
+    }
+    
+    w = 0;                                                                                /* init 0 */
+    t_max = 0;                                                                            /* init 0 */
+    samples = 0;                                                                          /* init 0 */
+    if (bus->lock != NULL)                                                                /* check lock */
+    {
+        bus->lock();                                                                      /* lock the bus */
+    }
+    for (i = 0; i < bus->num; i++)                                                        /* run all devices */
+    {
+        dev = &bus->device[i];                                                            /* get device */
+        t = gs_conversion_us[dev->slot[dev->cursor].rate & 0x07];                         /* get conversion time */
+        if (a_ads1118_bus_service(bus, i, ring, &samples) != 0)                           /* fetch and start */
+        {
+            if (bus->unlock != NULL)                                                      /* check unlock */
+            {
+                bus->unlock();                                                            /* unlock the bus */
+            }
+            
+            return 1;                                                                     /* return error */
+        }
+        if (t >= t_max)                                                                   /* the latest slowest slot */
+        {
+            t_max = t;                                                                    /* save time */
+            w = i;                                                                        /* save device */
+        }
+    }
+    if (bus->unlock != NULL)                                                              /* check unlock */
+    {
+        bus->unlock();                                                                    /* unlock the bus */
+    }
+    
+    dev = &bus->device[w];                                                                /* get the last finished device */
+    slot = &dev->slot[dev->pending - 1];                                                  /* get its slot */
+    if (a_ads1118_wait_conversion(dev->handle, slot->rate) != 0)                          /* wait conversion */
+    {
+        return 1;                                                                         /* return error */
+    }
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      service every device whose conversion is finished
+ * @param[in]  *bus pointer to an ads1118 bus structure
+ * @param[in]  *ring pointer to an ads1118 ring structure
+ * @param[out] *samples pointer to a sample number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 poll failed
+ *             - 2 bus is NULL
+ *             - 3 bus is not initialized
+ *             - 4 a device has neither drdy nor get_time_us linked
+ * @note       it never waits, an idle device or a finished device fetches its result and starts its next slot at once,
+ *             so the conversions stay staggered and every chip runs at its own rate,
+ *             a device is finished when dout/drdy is low if drdy is linked,
+ *             drdy is not read before the minimum conversion time if get_time_us is linked too,
+ *             otherwise when its deadline of conversion time + 10% is passed,
+ *             samples is the number of results pushed into the ring
+ */
+uint8_t ads1118_bus_poll(ads1118_bus_t *bus, ads1118_ring_t *ring, uint32_t *samples)
+{
+    if ((bus == NULL) || (samples == NULL))                                               /* check bus */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (bus->inited != 1)                                                                 /* check bus initialization */
+    {
+        return 3;                                                                         /* return error */
+    }
+    
+    return a_ads1118_bus_poll(bus, ring, 0xFFFFFFFFU, samples);                           /* poll all devices */
+}
+
+/**
+ * @brief     run the interleaved scheduler until enough samples are collected
+ * @param[in] *bus pointer to an ads1118 bus structure
+ * @param[in] *ring pointer to an ads1118 ring structure
+ * @param[in] samples sample number
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 2 bus is NULL
+ *            - 3 bus is not initialized
+ *            - 4 a device has neither drdy nor get_time_us linked
+ * @note      the function polls the bus and sleeps until the next deadline or the next drdy poll between the polls,
+ *            the aggregate rate is close to the sum of the device rates while the bus has idle time,
+ *            exactly samples results are pushed and a finished device beyond them waits for the next call
+ */
+uint8_t ads1118_bus_run(ads1118_bus_t *bus, ads1118_ring_t *ring, uint32_t samples)
 {
+    uint8_t i;
+    uint8_t w;
     uint8_t res;
-    uint16_t conf;
+    uint32_t n;
+    uint32_t got;
+    uint32_t wait;
+    uint32_t idle;
+    uint64_t now;
+    ads1118_bus_device_t *dev;
     
-    if (handle == NULL)                                                /* check handle */
+    if (bus == NULL)                                                                      /* check bus */
     {
-        return 2;                                                      /* return error */
+        return 2;                                                                         /* return error */
     }
-    if (handle->inited != 1)                                           /* check handle initialization */
+    if (bus->inited != 1)                                                                 /* check bus initialization */
     {
-        return 3;                                                      /* return error */
+        return 3;                                                                         /* return error */
     }
     
-    res = a_ads1118_spi_read(handle, (uint16_t *)&conf);               /* read config */
-    if (res != 0)                                                      /* check error */
+    got = 0;                                                                              /* init 0 */
+    idle = 0;                                                                             /* init 0 */
+    while (got < samples)                                                                 /* collect samples */
     {
-        handle->debug_print("ads1118: read config failed.\n");         /* read config failed */
+        res = a_ads1118_bus_poll(bus, ring, samples - got, &n);                           /* poll all devices */
+        if (res != 0)                                                                     /* check the result */
+        {
+            return res;                                                                   /* return error */
+        }
+        got += n;                                                                         /* add the samples */
+        idle = (n != 0) ? 0 : idle;                                                       /* a sample resets the idle time */
+        if (got >= samples)                                                               /* check the sample number */
+        {
+            break;                                                                        /* break */
+        }
         
-        return 1;                                                      /* return error */
+        w = 0;                                                                            /* init 0 */
+        wait = 0xFFFFFFFFU;                                                               /* init max */
+        for (i = 0; i < bus->num; i++)                                                    /* find the next event */
+        {
+            dev = &bus->device[i];                                                        /* get device */
+            n = DRDY_POLL_US;                                                             /* init the poll interval */
+            if (dev->handle->get_time_us != NULL)                                         /* check the deadline */
+            {
+                now = a_ads1118_get_time_us(dev->handle);                                 /* get time */
+                if (dev->deadline > now)                                                  /* before the deadline */
+                {
+                    n = (uint32_t)(dev->deadline - now);                                  /* time to the deadline */
+                }
+                else if ((dev->handle->drdy_read == NULL) &&
+                         (dev->handle->drdy_read_ctx == NULL))                            /* the deadline is passed */
+                {
+                    n = 0;                                                                /* ready */
+                }
+                else
+                {
+                    n = DRDY_POLL_US;                                                     /* poll interval */
+                }
+            }
+            if (n < wait)                                                                 /* the nearest event */
+            {
+                wait = n;                                                                 /* save time */
+                w = i;                                                                    /* save device */
+            }
+        }
+        if (wait == 0)                                                                    /* a device is ready */
+        {
+            continue;                                                                     /* poll again */
+        }
+        idle += wait;                                                                     /* add the idle time */
+        if (idle > gs_conversion_us[0] + gs_conversion_us[0] / 10 + DRDY_TIMEOUT_US)      /* check timeout */
+        {
+            bus->device[w].handle->debug_print("ads1118: conversion timeout.\n");         /* conversion timeout */
+            
+            return 1;                                                                     /* return error */
+        }
+        if (bus->device[w].handle->delay_us != NULL)                                      /* if delay_us is linked */
+        {
+            a_ads1118_delay_us(bus->device[w].handle, wait);                              /* sleep until the event */
+        }
+        else
+        {
+            a_ads1118_delay_ms(bus->device[w].handle, (wait + 999) / 1000);               /* sleep until the event */
+        }
     }
-    conf &= ~(0x07 << 9);                                              /* clear range */
-    conf |= (range & 0x07) << 9;                                       /* set range */
-    conf &= ~(3 << 1);                                                 /* clear nop */
-    conf |= COMMAND_VALID;                                             /* set command valid */
-    res = a_ads1118_spi_write(handle, conf);                           /* write config */
-    if (res != 0)                                                      /* check error */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     initialize the sample ring
+ * @param[in] *ring pointer to an ads1118 ring structure
+ * @param[in] *buf pointer to a sample buffer
+ * @param[in] size buffer size
+ * @return    status code
+ *            - 0 success
+ *            - 2 ring is NULL
+ *            - 4 size is invalid
+ * @note      size must be a power of 2,
+ *            the ring is lock free with one producer and one consumer
+ */
+uint8_t ads1118_ring_init(ads1118_ring_t *ring, ads1118_sample_t *buf, uint32_t size)
+{
+    if (ring == NULL)                                   /* check ring */
     {
-        handle->debug_print("ads1118: write config failed.\n");        /* write config failed */
+        return 2;                                       /* return error */
+    }
+    if ((buf == NULL) || (size == 0) ||
+        ((size & (size - 1)) != 0))                     /* check size */
+    {
+        return 4;                                       /* return error */
+    }
+    
+    ring->buf = buf;                                    /* set buffer */
+    ring->size = size;                                  /* set size */
+    ring->head = 0;                                     /* init 0 */
+    ring->tail = 0;                                     /* init 0 */
+    ring->overrun = 0;                                  /* init 0 */
+    
+    return 0;                                           /* success return 0 */
+}
+
+/**
+ * @brief     push a sample into the ring
+ * @param[in] *ring pointer to an ads1118 ring structure
+ * @param[in] *sample pointer to a sample
+ * @return    status code
+ *            - 0 success
+ *            - 1 ring is full
+ *            - 2 ring is NULL
+ * @note      only call it from the producer, it can be used in the interrupt,
+ *            the sample is dropped and counted as an overrun if the ring is full
+ */
+uint8_t ads1118_ring_push(ads1118_ring_t *ring, const ads1118_sample_t *sample)
+{
+    uint32_t head;
+    uint32_t tail;
+    
+    if (ring == NULL)                                           /* check ring */
+    {
+        return 2;                                               /* return error */
+    }
+    
+    head = ring->head;                                          /* only the producer writes head */
+    tail = RING_LOAD(&ring->tail);                              /* get tail */
+    if ((head - tail) >= ring->size)                            /* check full */
+    {
+        RING_STORE(&ring->overrun, ring->overrun + 1);          /* count the dropped sample */
         
-        return 1;                                                      /* return error */
+        return 1;                                               /* return error */
+    }
+    ring->buf[head & (ring->size - 1)] = *sample;               /* copy the sample */
+    RING_STORE(&ring->head, head + 1);                          /* publish the sample */
+    
+    return 0;                                                   /* success return 0 */
+}
+
+/**
+ * @brief         pop samples from the ring
+ * @param[in]     *ring pointer to an ads1118 ring structure
+ * @param[out]    *sample pointer to a sample buffer
+ * @param[in,out] *len pointer to a length buffer
+ * @return        status code
+ *                - 0 success
+ *                - 2 ring is NULL
+ * @note          only call it from the consumer, it never blocks,
+ *                len is the buffer length in and the popped length out
+ */
+uint8_t ads1118_ring_pop(ads1118_ring_t *ring, ads1118_sample_t *sample, uint32_t *len)
+{
+    uint32_t i;
+    uint32_t n;
+    uint32_t head;
+    uint32_t tail;
+    
+    if (ring == NULL)                                                  /* check ring */
+    {
+        return 2;                                                      /* return error */
+    }
+    
+    tail = ring->tail;                                                 /* only the consumer writes tail */
+    head = RING_LOAD(&ring->head);                                     /* get head */
+    n = head - tail;                                                   /* get available samples */
+    if (n > (*len))                                                    /* limit to the buffer */
+    {
+        n = *len;                                                      /* set the buffer length */
+    }
+    for (i = 0; i < n; i++)                                            /* copy all samples */
+    {
+        sample[i] = ring->buf[(tail + i) & (ring->size - 1)];          /* copy the sample */
     }
+    RING_STORE(&ring->tail, tail + n);                                 /* release the slots */
+    *len = n;                                                          /* set the popped length */
     
     return 0;                                                          /* success return 0 */
 }
 
 /**
- * @brief      get the adc range
- * @param[in]  *handle pointer to an ads1118 handle structure
- * @param[out] *range pointer to a voltage range buffer
+ * @brief      get the sample number in the ring
+ * @param[in]  *ring pointer to an ads1118 ring structure
+ * @param[out] *count pointer to a count buffer
  * @return     status code
  *             - 0 success
- *             - 1 get range failed
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
+ *             - 2 ring is NULL
  * @note       none
  */
-uint8_t ads1118_get_range(ads1118_handle_t *handle, ads1118_range_t *range)
+uint8_t ads1118_ring_get_count(ads1118_ring_t *ring, uint32_t *count)
 {
-    uint8_t res;
-    uint16_t conf;
+    uint32_t tail;
     
-    if (handle == NULL)                                               /* check handle */
+    if (ring == NULL)                                                  /* check ring */
     {
-        return 2;                                                     /* return error */
+        return 2;                                                      /* return error */
     }
-    if (handle->inited != 1)                                          /* check handle initialization */
+    
+    tail = RING_LOAD(&ring->tail);                                     /* get tail first */
+    *count = RING_LOAD(&ring->head) - tail;                            /* get count */
+    
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief      get the dropped sample number
+ * @param[in]  *ring pointer to an ads1118 ring structure
+ * @param[out] *overrun pointer to an overrun buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring is NULL
+ * @note       the counter is never cleared, compare two readings to get the new drops
+ */
+uint8_t ads1118_ring_get_overrun(ads1118_ring_t *ring, uint32_t *overrun)
+{
+    if (ring == NULL)                                 /* check ring */
     {
-        return 3;                                                     /* return error */
+        return 2;                                     /* return error */
     }
     
-    res = a_ads1118_spi_read(handle, (uint16_t *)&conf);              /* read config */
-    if (res != 0)                                                     /* check error */
+    *overrun = RING_LOAD(&ring->overrun);             /* get overrun */
+    
+    return 0;                                         /* success return 0 */
+}
+
+/**
+ * @brief     scale a filter sum to the output
+ * @param[in] sum filter sum
+ * @param[in] gain dc gain of the sum
+ * @return    output with ADS1118_FILTER_FRAC_BITS fraction bits
+ * @note      rounded half away from zero
+ */
+static int32_t a_ads1118_filter_scale(int64_t sum, uint64_t gain)
+{
+    int64_t q;
+    int64_t half;
+    
+    q = sum * (1LL << ADS1118_FILTER_FRAC_BITS);                                    /* add the fraction bits */
+    half = (int64_t)(gain / 2);                                                     /* half of the gain */
+    if (q >= 0)                                                                     /* positive */
     {
-        handle->debug_print("ads1118: read config failed.\n");        /* read config failed */
-        
-        return 1;                                                     /* return error */
+        return (int32_t)((q + half) / (int64_t)gain);                               /* round up */
+    }
+    else
+    {
+        return (int32_t)(-((-q + half) / (int64_t)gain));                           /* round down */
+    }
+}
+
+/**
+ * @brief      run a block through the boxcar decimator
+ * @param[in]  *filter pointer to an ads1118 filter structure
+ * @param[in]  *in pointer to a raw adc buffer
+ * @param[in]  len input length
+ * @param[out] *out pointer to a filter output buffer
+ * @return     output length
+ * @note       the inputs of one output are summed in one tight loop
+ */
+static uint32_t a_ads1118_filter_boxcar(ads1118_filter_t *filter, const int16_t *in, uint32_t len, int32_t *out)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t m;
+    uint32_t n;
+    int32_t acc;
+    
+    n = 0;                                                                          /* no output */
+    i = 0;                                                                          /* first input */
+    acc = filter->acc;                                                              /* load accumulator */
+    while (i < len)                                                                 /* run all inputs */
+    {
+        m = filter->ratio - filter->phase;                                          /* inputs to the next output */
+        if (m > (len - i))                                                          /* limit to the block */
+        {
+            m = len - i;                                                            /* set the rest */
+        }
+        for (j = 0; j < m; j++)                                                     /* sum the inputs */
+        {
+            acc += in[i + j];                                                       /* add */
+        }
+        i += m;                                                                     /* next input */
+        filter->phase = (uint16_t)(filter->phase + m);                              /* move the phase */
+        if (filter->phase == filter->ratio)                                         /* an output is ready */
+        {
+            out[n] = a_ads1118_filter_scale(acc, filter->gain);                     /* output the mean */
+            n++;                                                                    /* count the output */
+            acc = 0;                                                                /* clear accumulator */
+            filter->phase = 0;                                                      /* restart the phase */
+        }
+    }
+    filter->acc = acc;                                                              /* save accumulator */
+    
+    return n;                                                                       /* return output length */
+}
+
+/**
+ * @brief      run a block through the cic decimator
+ * @param[in]  *filter pointer to an ads1118 filter structure
+ * @param[in]  *in pointer to a raw adc buffer
+ * @param[in]  len input length
+ * @param[out] *out pointer to a filter output buffer
+ * @return     output length
+ * @note       integrators and combs wrap modulo 2^64, the output is exact while ratio ^ order fits
+ */
+static uint32_t a_ads1118_filter_cic(ads1118_filter_t *filter, const int16_t *in, uint32_t len, int32_t *out)
+{
+    uint32_t i;
+    uint32_t n;
+    uint16_t phase;
+    uint8_t k;
+    uint8_t order;
+    uint64_t s;
+    uint64_t t;
+    uint64_t v[ADS1118_FILTER_ORDER_MAX];
+    
+    order = filter->order;                                                          /* get order */
+    phase = filter->phase;                                                          /* get phase */
+    for (k = 0; k < order; k++)                                                     /* load the integrators */
+    {
+        v[k] = (uint64_t)filter->integrator[k];                                     /* keep them in registers */
+    }
+    n = 0;                                                                          /* no output */
+    for (i = 0; i < len; i++)                                                       /* run all inputs */
+    {
+        s = (uint64_t)(int64_t)in[i];                                               /* sign extend */
+        for (k = 0; k < order; k++)                                                 /* run the integrators */
+        {
+            v[k] += s;                                                              /* integrate */
+            s = v[k];                                                               /* feed the next stage */
+        }
+        phase++;                                                                    /* move the phase */
+        if (phase == filter->ratio)                                                 /* an output is ready */
+        {
+            for (k = 0; k < order; k++)                                             /* run the combs at the low rate */
+            {
+                t = s;                                                              /* save the input */
+                s -= (uint64_t)filter->comb[k];                                     /* differentiate */
+                filter->comb[k] = t;                                                /* delay */
+            }
+            out[n] = a_ads1118_filter_scale((int64_t)s, filter->gain);              /* remove the dc gain */
+            n++;                                                                    /* count the output */
+            phase = 0;                                                              /* restart the phase */
+        }
+    }
+    for (k = 0; k < order; k++)                                                     /* save the integrators */
+    {
+        filter->integrator[k] = v[k];                                               /* store */
+    }
+    filter->phase = phase;                                                          /* save phase */
+    
+    return n;                                                                       /* return output length */
+}
+
+/**
+ * @brief      run a block through the cic decimator with 32 bit registers
+ * @param[in]  *filter pointer to an ads1118 filter structure
+ * @param[in]  *in pointer to a raw adc buffer
+ * @param[in]  len input length
+ * @param[out] *out pointer to a filter output buffer
+ * @return     output length
+ * @note       integrators and combs wrap modulo 2^32, the output is exact while ratio ^ order is not more than 2^16,
+ *             the integrators of orders 1 to 3 are unrolled and run without the phase check
+ */
+static uint32_t a_ads1118_filter_cic32(ads1118_filter_t *filter, const int16_t *in, uint32_t len, int32_t *out)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t m;
+    uint32_t n;
+    uint8_t k;
+    uint8_t order;
+    uint32_t s;
+    uint32_t t;
+    uint32_t v[ADS1118_FILTER_ORDER_MAX];
+    
+    order = filter->order;                                                          /* get order */
+    for (k = 0; k < order; k++)                                                     /* load the integrators */
+    {
+        v[k] = (uint32_t)filter->integrator[k];                                     /* keep them in registers */
+    }
+    n = 0;                                                                          /* no output */
+    i = 0;                                                                          /* first input */
+    while (i < len)                                                                 /* run all inputs */
+    {
+        m = filter->ratio - filter->phase;                                          /* inputs to the next output */
+        if (m > (len - i))                                                          /* limit to the block */
+        {
+            m = len - i;                                                            /* set the rest */
+        }
+        if (order == 1)                                                             /* first order */
+        {
+            for (j = 0; j < m; j++)                                                 /* run the integrator */
+            {
+                v[0] += (uint32_t)(int32_t)in[i + j];                               /* integrate */
+            }
+        }
+        else if (order == 2)                                                        /* second order */
+        {
+            for (j = 0; j < m; j++)                                                 /* run the integrators */
+            {
+                v[0] += (uint32_t)(int32_t)in[i + j];                               /* integrate */
+                v[1] += v[0];                                                       /* integrate */
+            }
+        }
+        else if (order == 3)                                                        /* third order */
+        {
+            for (j = 0; j < m; j++)                                                 /* run the integrators */
+            {
+                v[0] += (uint32_t)(int32_t)in[i + j];                               /* integrate */
+                v[1] += v[0];                                                       /* integrate */
+                v[2] += v[1];                                                       /* integrate */
+            }
+        }
+        else
+        {
+            for (j = 0; j < m; j++)                                                 /* run the integrators */
+            {
+                s = (uint32_t)(int32_t)in[i + j];                                   /* sign extend */
+                for (k = 0; k < order; k++)                                         /* run all stages */
+                {
+                    v[k] += s;                                                      /* integrate */
+                    s = v[k];                                                       /* feed the next stage */
+                }
+            }
+        }
+        i += m;                                                                     /* next input */
+        filter->phase = (uint16_t)(filter->phase + m);                              /* move the phase */
+        if (filter->phase == filter->ratio)                                         /* an output is ready */
+        {
+            s = v[order - 1];                                                       /* last integrator */
+            for (k = 0; k < order; k++)                                             /* run the combs at the low rate */
+            {
+                t = s;                                                              /* save the input */
+                s -= (uint32_t)filter->comb[k];                                     /* differentiate */
+                filter->comb[k] = t;                                                /* delay */
+            }
+            out[n] = a_ads1118_filter_scale((int32_t)s, filter->gain);              /* remove the dc gain */
+            n++;                                                                    /* count the output */
+            filter->phase = 0;                                                      /* restart the phase */
+        }
+    }
+    for (k = 0; k < order; k++)                                                     /* save the integrators */
+    {
+        filter->integrator[k] = v[k];                                               /* store */
+    }
+    
+    return n;                                                                       /* return output length */
+}
+
+/**
+ * @brief      run a block through the fir decimator
+ * @param[in]  *filter pointer to an ads1118 filter structure
+ * @param[in]  *in pointer to a raw adc buffer
+ * @param[in]  len input length
+ * @param[out] *out pointer to a filter output buffer
+ * @return     output length
+ * @note       the delay line is stored twice so the taps are read without a wrap
+ */
+static uint32_t a_ads1118_filter_fir(ads1118_filter_t *filter, const int16_t *in, uint32_t len, int32_t *out)
+{
+    uint32_t i;
+    uint32_t n;
+    uint16_t k;
+    uint16_t pos;
+    uint16_t taps;
+    int64_t acc;
+    int16_t *h;
+    const int16_t *c;
+    
+    h = filter->history;                                                            /* get delay line */
+    c = filter->coef;                                                               /* get coefficients */
+    taps = filter->taps;                                                            /* get taps */
+    pos = filter->pos;                                                              /* get position */
+    n = 0;                                                                          /* no output */
+    for (i = 0; i < len; i++)                                                       /* run all inputs */
+    {
+        h[pos] = in[i];                                                             /* save the input */
+        h[pos + taps] = in[i];                                                      /* save the copy */
+        pos++;                                                                      /* move the position */
+        if (pos == taps)                                                            /* check the end */
+        {
+            pos = 0;                                                                /* wrap */
+        }
+        filter->phase++;                                                            /* move the phase */
+        if (filter->phase == filter->ratio)                                         /* an output is ready */
+        {
+            acc = 0;                                                                /* clear accumulator */
+            for (k = 0; k < taps; k++)                                              /* oldest input first */
+            {
+                acc += (int32_t)c[taps - 1 - k] * h[pos + k];                       /* multiply and accumulate */
+            }
+            out[n] = a_ads1118_filter_scale(acc, filter->gain);                     /* remove the q15 scale */
+            n++;                                                                    /* count the output */
+            filter->phase = 0;                                                      /* restart the phase */
+        }
     }
-    *range = (ads1118_range_t)((conf >> 9) & 0x07);                   /* get range */
+    filter->pos = pos;                                                              /* save position */
     
-    return 0;                                                         /* success return 0 */
+    return n;                                                                       /* return output length */
 }
 
 /**
- * @brief     set the sample rate
- * @param[in] *handle pointer to an ads1118 handle structure
- * @param[in] rate adc sample rate
+ * @brief     initialize a boxcar decimator
+ * @param[in] *filter pointer to an ads1118 filter structure
+ * @param[in] ratio decimation ratio
  * @return    status code
  *            - 0 success
- *            - 1 set rate failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ *            - 2 filter is NULL
+ *            - 4 ratio is invalid
+ * @note      one output is the mean of ratio inputs
  */
-uint8_t ads1118_set_rate(ads1118_handle_t *handle, ads1118_rate_t rate)
+uint8_t ads1118_filter_boxcar_init(ads1118_filter_t *filter, uint16_t ratio)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                /* check handle */
+    if (filter == NULL)                                     /* check filter */
     {
-        return 2;                                                      /* return error */
+        return 2;                                           /* return error */
     }
-    if (handle->inited != 1)                                           /* check handle initialization */
+    if (ratio == 0)                                         /* check ratio */
     {
-        return 3;                                                      /* return error */
+        return 4;                                           /* return error */
     }
     
-    res = a_ads1118_spi_read(handle, (uint16_t *)&conf);               /* read config */
-    if (res != 0)                                                      /* check error */
-    {
-        handle->debug_print("ads1118: read config failed.\n");         /* read config failed */
-        
-        return 1;                                                      /* return error */
-    }
-    conf &= ~(0x07 << 5);                                              /* clear rate */
-    conf |= (rate & 0x07) << 5;                                        /* set rate */
-    conf &= ~(3 << 1);                                                 /* clear nop */
-    conf |= COMMAND_VALID;                                             /* set command valid */
-    res = a_ads1118_spi_write(handle, conf);                           /* write config */
-    if (res != 0)                                                      /* check error */
-    {
-        handle->debug_print("ads1118: write config failed.\n");        /* write config failed */
-        
-        return 1;                                                      /* return error */
-    }
+    memset(filter, 0, sizeof(ads1118_filter_t));            /* clear the filter */
+    filter->type = ADS1118_FILTER_TYPE_BOXCAR;              /* set type */
+    filter->ratio = ratio;                                  /* set ratio */
+    filter->gain = ratio;                                   /* the sum of ratio inputs */
+    filter->inited = 1;                                     /* flag inited */
     
-    return 0;                                                          /* success return */
+    return 0;                                               /* success return 0 */
 }
 
 /**
- * @brief      get the sample rate
- * @param[in]  *handle pointer to an ads1118 handle structure
- * @param[out] *rate pointer to an adc sample rate buffer
- * @return     status code
- *             - 0 success
- *             - 1 get rate failed
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
+ * @brief     initialize a cic decimator
+ * @param[in] *filter pointer to an ads1118 filter structure
+ * @param[in] ratio decimation ratio
+ * @param[in] order cic order from 1 to ADS1118_FILTER_ORDER_MAX
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ *            - 4 ratio or order is invalid
+ * @note      ratio ^ order must not be more than 2^32,
+ *            the dc gain is removed so the output has the scale of the input
  */
-uint8_t ads1118_get_rate(ads1118_handle_t *handle, ads1118_rate_t *rate)
+uint8_t ads1118_filter_cic_init(ads1118_filter_t *filter, uint16_t ratio, uint8_t order)
 {
-    uint8_t res;
-    uint16_t conf;
+    uint8_t i;
+    uint64_t gain;
     
-    if (handle == NULL)                                               /* check handle */
+    if (filter == NULL)                                                                     /* check filter */
     {
-        return 2;                                                     /* return error */
+        return 2;                                                                           /* return error */
     }
-    if (handle->inited != 1)                                          /* check handle initialization */
+    if ((ratio == 0) || (order == 0) || (order > ADS1118_FILTER_ORDER_MAX))                 /* check ratio and order */
     {
-        return 3;                                                     /* return error */
+        return 4;                                                                           /* return error */
     }
-    
-    res = a_ads1118_spi_read(handle, (uint16_t *)&conf);              /* read config */
-    if (res != 0)                                                     /* check error */
+    gain = 1;                                                                               /* init 1 */
+    for (i = 0; i < order; i++)                                                             /* ratio ^ order */
     {
-        handle->debug_print("ads1118: read config failed.\n");        /* read config failed */
-        
-        return 1;                                                     /* return error */
+        gain *= ratio;                                                                      /* multiply */
+        if (gain > (1ULL << 32))                                                            /* check the range */
+        {
+            return 4;                                                                       /* return error */
+        }
     }
-    *rate = (ads1118_rate_t)((conf >> 5) & 0x07);                     /* get rate */
     
-    return 0;                                                         /* success return 0 */
+    memset(filter, 0, sizeof(ads1118_filter_t));                                            /* clear the filter */
+    filter->type = ADS1118_FILTER_TYPE_CIC;                                                 /* set type */
+    filter->ratio = ratio;                                                                  /* set ratio */
+    filter->order = order;                                                                  /* set order */
+    filter->gain = gain;                                                                    /* set dc gain */
+    filter->inited = 1;                                                                     /* flag inited */
+    
+    return 0;                                                                               /* success return 0 */
 }
 
 /**
- * @brief     set the chip mode
- * @param[in] *handle pointer to an ads1118 handle structure
- * @param[in] mode chip mode
+ * @brief     initialize a fir decimator
+ * @param[in] *filter pointer to an ads1118 filter structure
+ * @param[in] ratio decimation ratio
+ * @param[in] *coef pointer to a q15 coefficient buffer
+ * @param[in] *history pointer to a delay line buffer
+ * @param[in] taps tap number
  * @return    status code
  *            - 0 success
- *            - 1 set mode failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ *            - 2 filter is NULL
+ *            - 4 ratio or taps is invalid
+ * @note      history must hold 2 * taps samples and coef must live as long as the filter,
+ *            the coefficients sum to 32768 for a dc gain of 1,
+ *            only every ratio-th output is computed
  */
-uint8_t ads1118_set_mode(ads1118_handle_t *handle, ads1118_mode_t mode)
+uint8_t ads1118_filter_fir_init(ads1118_filter_t *filter, uint16_t ratio, const int16_t *coef,
+                                 int16_t *history, uint16_t taps)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                /* check handle */
+    if (filter == NULL)                                                                     /* check filter */
     {
-        return 2;                                                      /* return error */
+        return 2;                                                                           /* return error */
     }
-    if (handle->inited != 1)                                           /* check handle initialization */
+    if ((ratio == 0) || (coef == NULL) || (history == NULL) || (taps == 0))                 /* check ratio and taps */
     {
-        return 3;                                                      /* return error */
+        return 4;                                                                           /* return error */
     }
     
-    res = a_ads1118_spi_read(handle, (uint16_t *)&conf);               /* read config */
-    if (res != 0)                                                      /* check error */
-    {
-        handle->debug_print("ads1118: read config failed.\n");         /* read config failed */
-        
-        return 1;                                                      /* return error */
-    }
-    conf &= ~(1 << 4);                                                 /* clear settings */
-    conf |= mode << 4;                                                 /* set mode */
-    conf &= ~(3 << 1);                                                 /* clear nop */
-    conf |= COMMAND_VALID;                                             /* set command valid */
-    res = a_ads1118_spi_write(handle, conf);                           /* write config */
-    if (res != 0)                                                      /* check error */
-    {
-        handle->debug_print("ads1118: write config failed.\n");        /* write config failed */
-        
-        return 1;                                                      /* return error */
-    }
+    memset(filter, 0, sizeof(ads1118_filter_t));                                            /* clear the filter */
+    memset(history, 0, sizeof(int16_t) * 2 * taps);                                         /* clear the delay line */
+    filter->type = ADS1118_FILTER_TYPE_FIR;                                                 /* set type */
+    filter->ratio = ratio;                                                                  /* set ratio */
+    filter->gain = 32768;                                                                   /* q15 coefficients */
+    filter->coef = coef;                                                                    /* set coefficients */
+    filter->history = history;                                                              /* set delay line */
+    filter->taps = taps;                                                                    /* set taps */
+    filter->inited = 1;                                                                     /* flag inited */
     
-    return 0;                                                          /* success return */
+    return 0;                                                                               /* success return 0 */
 }
 
 /**
- * @brief      get the chip mode
- * @param[in]  *handle pointer to an ads1118 handle structure
- * @param[out] *mode pointer to a mode buffer
- * @return     status code
- *             - 0 success
- *             - 1 get mode failed
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
+ * @brief     reset the filter state
+ * @param[in] *filter pointer to an ads1118 filter structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ *            - 3 filter is not initialized
+ * @note      the type, ratio and coefficients are kept
  */
-uint8_t ads1118_get_mode(ads1118_handle_t *handle, ads1118_mode_t *mode)
+uint8_t ads1118_filter_reset(ads1118_filter_t *filter)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                               /* check handle */
+    if (filter == NULL)                                                                   /* check filter */
     {
-        return 2;                                                     /* return error */
+        return 2;                                                                         /* return error */
     }
-    if (handle->inited != 1)                                          /* check handle initialization */
+    if (filter->inited != 1)                                                              /* check filter initialization */
     {
-        return 3;                                                     /* return error */
+        return 3;                                                                         /* return error */
     }
     
-    res = a_ads1118_spi_read(handle, (uint16_t *)&conf);              /* read config */
-    if (res != 0)                                                     /* check error */
+    filter->phase = 0;                                                                    /* no input */
+    filter->acc = 0;                                                                      /* clear accumulator */
+    memset(filter->integrator, 0, sizeof(filter->integrator));                            /* clear integrators */
+    memset(filter->comb, 0, sizeof(filter->comb));                                        /* clear combs */
+    filter->pos = 0;                                                                      /* reset position */
+    if (filter->history != NULL)                                                          /* check the delay line */
     {
-        handle->debug_print("ads1118: read config failed.\n");        /* read config failed */
-        
-        return 1;                                                     /* return error */
+        memset(filter->history, 0, sizeof(int16_t) * 2 * filter->taps);                   /* clear the delay line */
     }
-    *mode = (ads1118_mode_t)((conf >> 4) & 0x01);                     /* get mode */
     
-    return 0;                                                         /* success return 0 */
+    return 0;                                                                             /* success return 0 */
 }
 
 /**
- * @brief     enable or disable dout pull up
- * @param[in] *handle pointer to an ads1118 handle structure
- * @param[in] enable bool value
- * @return    status code
- *            - 0 success
- *            - 1 set dout pull up failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      run a block of raw data through the filter
+ * @param[in]  *filter pointer to an ads1118 filter structure
+ * @param[in]  *in pointer to a raw adc buffer
+ * @param[in]  len input length
+ * @param[out] *out pointer to a filter output buffer
+ * @param[out] *out_len pointer to an output length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 filter is NULL
+ *             - 3 filter is not initialized
+ * @note       out must hold len / ratio + 1 outputs,
+ *             an output is the raw code with ADS1118_FILTER_FRAC_BITS fraction bits,
+ *             the accumulation is integer only and rounded half away from zero at the output
  */
-uint8_t ads1118_set_dout_pull_up(ads1118_handle_t *handle, ads1118_bool_t enable)
+uint8_t ads1118_filter_process(ads1118_filter_t *filter, const int16_t *in, uint32_t len,
+                               int32_t *out, uint32_t *out_len)
 {
-    uint8_t res;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                /* check handle */
+    if (filter == NULL)                                                           /* check filter */
     {
-        return 2;                                                      /* return error */
+        return 2;                                                                 /* return error */
     }
-    if (handle->inited != 1)                                           /* check handle initialization */
+    if (filter->inited != 1)                                                      /* check filter initialization */
     {
-        return 3;                                                      /* return error */
+        return 3;                                                                 /* return error */
     }
     
-    res = a_ads1118_spi_read(handle, (uint16_t *)&conf);               /* read config */
-    if (res != 0)                                                      /* check error */
+    if ((filter->type == ADS1118_FILTER_TYPE_CIC) && (filter->gain <= 65536))     /* 16 bit growth */
     {
-        handle->debug_print("ads1118: read config failed.\n");         /* read config failed */
-        
-        return 1;                                                      /* return error */
+        *out_len = a_ads1118_filter_cic32(filter, in, len, out);                  /* run cic in 32 bits */
     }
-    conf &= ~(1 << 3);                                                 /* clear settings */
-    conf |= enable << 3;                                               /* set enable */
-    conf &= ~(3 << 1);                                                 /* clear nop */
-    conf |= COMMAND_VALID;                                             /* set command valid */
-    res = a_ads1118_spi_write(handle, conf);                           /* write config */
-    if (res != 0)                                                      /* check error */
+    else if (filter->type == ADS1118_FILTER_TYPE_CIC)                             /* cic */
     {
-        handle->debug_print("ads1118: write config failed.\n");        /* write config failed */
-        
-        return 1;                                                      /* return error */
+        *out_len = a_ads1118_filter_cic(filter, in, len, out);                    /* run cic */
+    }
+    else if (filter->type == ADS1118_FILTER_TYPE_FIR)                             /* fir */
+    {
+        *out_len = a_ads1118_filter_fir(filter, in, len, out);                    /* run fir */
+    }
+    else
+    {
+        *out_len = a_ads1118_filter_boxcar(filter, in, len, out);                 /* run boxcar */
     }
     
-    return 0;                                                          /* success return */
+    return 0;                                                                     /* success return 0 */
 }
 
 /**
- * @brief      get dout pull up status
- * @param[in]  *handle pointer to an ads1118 handle structure
- * @param[out] *enable pointer to a bool value buffer
+ * @brief      convert a filter output block to the voltage
+ * @param[in]  range adc range
+ * @param[in]  *in pointer to a filter output buffer
+ * @param[out] *v pointer to a converted adc buffer
+ * @param[in]  n buffer length
  * @return     status code
  *             - 0 success
- *             - 1 get dout pull up failed
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
+ *             - 1 range is invalid
  * @note       none
  */
-uint8_t ads1118_get_dout_pull_up(ads1118_handle_t *handle, ads1118_bool_t *enable)
+uint8_t ads1118_filter_to_volts_n(ads1118_range_t range, const int32_t *in, float *v, uint32_t n)
 {
-    uint8_t res;
-    uint16_t conf;
+    uint32_t i;
+    float lsb;
     
-    if (handle == NULL)                                                /* check handle */
-    {
-        return 2;                                                      /* return error */
-    }
-    if (handle->inited != 1)                                           /* check handle initialization */
+    if (range > ADS1118_RANGE_0P256V)                                           /* check range */
     {
-        return 3;                                                      /* return error */
+        return 1;                                                               /* return error */
     }
     
-    res = a_ads1118_spi_read(handle, (uint16_t *)&conf);               /* read config */
-    if (res != 0)                                                      /* check error */
+    lsb = gs_lsb_v[range] / (float)(1UL << ADS1118_FILTER_FRAC_BITS);           /* exact, both are powers of 2 */
+    for (i = 0; i < n; i++)                                                     /* convert all outputs */
     {
-        handle->debug_print("ads1118: read config failed.\n");         /* read config failed */
-        
-        return 1;                                                      /* return error */
+        v[i] = (float)in[i] * lsb;                                              /* convert */
     }
-    *enable = (ads1118_bool_t)((conf >> 3) & 0x01);                    /* get bool */
     
-    return 0;                                                          /* success return */
+    return 0;                                                                   /* success return 0 */
 }
 
 /**
- * @brief      read data from the chip once
- * @param[in]  *handle pointer to an ads1118 handle structure
- * @param[out] *raw pointer to a raw adc buffer
- * @param[out] *v pointer to a converted adc buffer
- * @return     status code
- *             - 0 success
- *             - 1 single read failed
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
+ * @brief thermocouple reference function definition
+ * @note  nist its-90 polynomials of the emf in mV from the temperature in C,
+ *        [type][0] is the segment up to the split temperature and [type][1] the one above it
  */
-uint8_t ads1118_single_read(ads1118_handle_t *handle, int16_t *raw, float *v)
+static const float gs_tc_fwd_coef[5][2][15] =
 {
-    uint8_t res;
-    uint8_t range;
-    uint8_t rate;
-    uint16_t conf;
-    
-    if (handle == NULL)                                                   /* check handle */
     {
-        return 2;                                                         /* return error */
-    }
-    if (handle->inited != 1)                                              /* check handle initialization */
+        {
+            0.000000000E+00f, 3.945012803E-02f, 2.362237360E-05f, -3.285890678E-07f,
+            -4.990482878E-09f, -6.750905917E-11f, -5.741032743E-13f, -3.108887289E-15f,
+            -1.045160937E-17f, -1.988926688E-20f, -1.632269749E-23f, 0.0f,
+            0.0f, 0.0f, 0.0f,
+        },
+        {
+            -1.760041369E-02f, 3.892120497E-02f, 1.855877003E-05f, -9.945759287E-08f,
+            3.184094572E-10f, -5.607284489E-13f, 5.607505906E-16f, -3.202072000E-19f,
+            9.715114715E-23f, -1.210472128E-26f, 0.0f, 0.0f,
+            0.0f, 0.0f, 0.0f,
+        },
+    },
     {
-        return 3;                                                         /* return error */
-    }
-    
-    res = a_ads1118_spi_read(handle, (uint16_t *)&conf);                  /* read config */
-    if (res != 0)                                                         /* check error */
+        {
+            0.000000000E+00f, 5.038118781E-02f, 3.047583693E-05f, -8.568106572E-08f,
+            1.322819529E-10f, -1.705295834E-13f, 2.094809070E-16f, -1.253839534E-19f,
+            1.563172570E-23f, 0.0f, 0.0f, 0.0f,
+            0.0f, 0.0f, 0.0f,
+        },
+        {
+            2.964562568E+02f, -1.497612779E+00f, 3.178710392E-03f, -3.184768670E-06f,
+            1.572081900E-09f, -3.069136906E-13f, 0.0f, 0.0f,
+            0.0f, 0.0f, 0.0f, 0.0f,
+            0.0f, 0.0f, 0.0f,
+        },
+    },
     {
-        handle->debug_print("ads1118: read config failed.\n");            /* read config failed */
-        
-        return 1;                                                         /* return error */
-    }
-    range = (ads1118_range_t)((conf >> 9) & 0x07);                        /* get range conf */
-    conf &= ~(1 << 8);                                                    /* clear bit */
-    conf |= 1 << 8;                                                       /* set single read */
-    conf |= 1 << 15;                                                      /* start single read */
-    res = a_ads1118_spi_write(handle, conf);                              /* write config */
-    if (res != 0)                                                         /* check error */
+        {
+            0.000000000E+00f, 3.874810636E-02f, 4.419443435E-05f, 1.184432310E-07f,
+            2.003297355E-08f, 9.013801956E-10f, 2.265115659E-11f, 3.607115421E-13f,
+            3.849393988E-15f, 2.821352193E-17f, 1.425159478E-19f, 4.876866229E-22f,
+            1.079553927E-24f, 1.394502706E-27f, 7.979515393E-31f,
+        },
+        {
+            0.000000000E+00f, 3.874810636E-02f, 3.329222788E-05f, 2.061824340E-07f,
+            -2.188225685E-09f, 1.099688093E-11f, -3.081575877E-14f, 4.547913529E-17f,
+            -2.751290167E-20f, 0.0f, 0.0f, 0.0f,
+            0.0f, 0.0f, 0.0f,
+        },
+    },
     {
-        handle->debug_print("ads1118: write config failed.\n");           /* write config failed */
-        
-        return 1;                                                         /* return error */
-    }
-    rate = (conf >> 5) & 0x7;                                             /* set rate */
-    switch (rate)                                                         /* choose the rate */
+        {
+            0.000000000E+00f, 5.866550871E-02f, 4.541097712E-05f, -7.799804869E-07f,
+            -2.580016084E-08f, -5.945258306E-10f, -9.321405867E-12f, -1.028760553E-13f,
+            -8.037012362E-16f, -4.397949739E-18f, -1.641477635E-20f, -3.967361952E-23f,
+            -5.582732872E-26f, -3.465784201E-29f, 0.0f,
+        },
+        {
+            0.000000000E+00f, 5.866550871E-02f, 4.503227558E-05f, 2.890840721E-08f,
+            -3.305689665E-10f, 6.502440327E-13f, -1.919749550E-16f, -1.253660050E-18f,
+            2.148921757E-21f, -1.438804178E-24f, 3.596089948E-28f, 0.0f,
+            0.0f, 0.0f, 0.0f,
+        },
+    },
     {
-        case 0 :                                                          /* 8sps */
         {
-            handle->delay_ms(138);                                        /* > ((1000 / 8) *(1 + 10%)) */
-            
-            break;                                                        /* break */
-        }
-        case 1 :                                                          /* 16sps */
+            0.000000000E+00f, 2.615910596E-02f, 1.095748423E-05f, -9.384111155E-08f,
+            -4.641203976E-11f, -2.630335772E-12f, -2.265343800E-14f, -7.608930079E-17f,
+            -9.341966783E-20f, 0.0f, 0.0f, 0.0f,
+            0.0f, 0.0f, 0.0f,
+        },
         {
-            handle->delay_ms(69);                                         /* > ((1000 / 16) *(1 + 10%)) */
-            
-            break;                                                        /* break */
-        }
-        case 2 :                                                          /* 32sps */
+            0.000000000E+00f, 2.592939460E-02f, 1.571014188E-05f, 4.382562724E-08f,
+            -2.526116979E-10f, 6.431181934E-13f, -1.006347152E-15f, 9.974533899E-19f,
+            -6.086324561E-22f, 2.084922934E-25f, -3.068219615E-29f, 0.0f,
+            0.0f, 0.0f, 0.0f,
+        },
+    },
+};
+static const uint8_t gs_tc_fwd_len[5][2] = {{11, 10}, {9, 6}, {15, 9}, {14, 11}, {9, 11}};
+static const float gs_tc_fwd_split[5] = {0.0f, 760.0f, 0.0f, 0.0f, 0.0f};
+static const float gs_tc_fwd_min[5] = {-270.0f, -210.0f, -270.0f, -270.0f, -270.0f};
+static const float gs_tc_fwd_max[5] = {1372.0f, 1200.0f, 400.0f, 1000.0f, 1300.0f};
+static const float gs_tc_k_exp[3] = {1.185976000E-01f, -1.183432000E-04f, 1.269686000E+02f};
+
+/**
+ * @brief thermocouple inverse function definition
+ * @note  nist its-90 polynomials of the temperature in C from the emf in mV,
+ *        a segment is used up to its max emf, the unused third segments repeat the max of the second one
+ */
+static const float gs_tc_inv_coef[5][3][10] =
+{
+    {
         {
-            handle->delay_ms(35);                                         /* > ((1000 / 32) *(1 + 10%)) */
-            
-            break;                                                        /* break */
-        }
-        case 3 :                                                          /* 64sps */
+            0.000000000E+00f, 2.517346200E+01f, -1.166287800E+00f, -1.083363800E+00f,
+            -8.977354000E-01f, -3.734237700E-01f, -8.663264300E-02f, -1.045059800E-02f,
+            -5.192057700E-04f, 0.0f,
+        },
         {
-            handle->delay_ms(18);                                         /* > ((1000 / 64) *(1 + 10%)) */
-            
-            break;                                                        /* break */
-        }
-        case 4 :                                                          /* 128sps */
+            0.000000000E+00f, 2.508355000E+01f, 7.860106000E-02f, -2.503131000E-01f,
+            8.315270000E-02f, -1.228034000E-02f, 9.804036000E-04f, -4.413030000E-05f,
+            1.057734000E-06f, -1.052755000E-08f,
+        },
         {
-            handle->delay_ms(9);                                          /* > ((1000 / 128) *(1 + 10%)) */
-            
-            break;                                                        /* break */
-        }
-        case 5 :                                                          /* 250sps */
+            -1.318058000E+02f, 4.830222000E+01f, -1.646031000E+00f, 5.464731000E-02f,
+            -9.650715000E-04f, 8.802193000E-06f, -3.110810000E-08f, 0.0f,
+            0.0f, 0.0f,
+        },
+    },
+    {
         {
-            handle->delay_ms(5);                                          /* > ((1000 / 250) *(1 + 10%)) */
-            
-            break;                                                        /* break */
-        }
-        case 6 :                                                          /* 475sps */
+            0.000000000E+00f, 1.952826800E+01f, -1.228618500E+00f, -1.075217800E+00f,
+            -5.908693300E-01f, -1.725671300E-01f, -2.813151300E-02f, -2.396337000E-03f,
+            -8.382332100E-05f, 0.0f,
+        },
         {
-            handle->delay_ms(3);                                          /* > ((1000 / 475) *(1 + 10%)) */
-            
-            break;                                                        /* break */
-        }
-        case 7 :                                                          /* 860sps */
+            0.000000000E+00f, 1.978425000E+01f, -2.001204000E-01f, 1.036969000E-02f,
+            -2.549687000E-04f, 3.585153000E-06f, -5.344285000E-08f, 5.099890000E-10f,
+            0.0f, 0.0f,
+        },
         {
-            handle->delay_ms(2);                                          /* > ((1000 / 860) *(1 + 10%)) */
-            
-            break;                                                        /* break */
-        }
-        default :
+            -3.113581870E+03f, 3.005436840E+02f, -9.947732300E+00f, 1.702766300E-01f,
+            -1.430334680E-03f, 4.738860840E-06f, 0.0f, 0.0f,
+            0.0f, 0.0f,
+        },
+    },
+    {
         {
-            handle->delay_ms(200);                                        /* 200ms */
-            
-            break;                                                        /* break */
-        }
-    }
-    res = a_ads1118_spi_read_data(handle, raw);                           /* read data */
-    if (res != 0)                                                         /* check the result */
+            0.000000000E+00f, 2.594919200E+01f, -2.131696700E-01f, 7.901869200E-01f,
+            4.252777700E-01f, 1.330447300E-01f, 2.024144600E-02f, 1.266817100E-03f,
+            0.0f, 0.0f,
+        },
+        {
+            0.000000000E+00f, 2.592800000E+01f, -7.602961000E-01f, 4.637791000E-02f,
+            -2.165394000E-03f, 6.048144000E-05f, -7.293422000E-07f, 0.0f,
+            0.0f, 0.0f,
+        },
+        {
+            0.0f, 0.0f, 0.0f, 0.0f,
+            0.0f, 0.0f, 0.0f, 0.0f,
+            0.0f, 0.0f,
+        },
+    },
     {
-        handle->debug_print("ads1118: continues read failed.\n");         /* continues read failed */
-        
-        return 1;                                                         /* return error */
-    }
-    if (range == ADS1118_RANGE_6P144V)                                    /* if 6.144V */
+        {
+            0.000000000E+00f, 1.697728800E+01f, -4.351497000E-01f, -1.585969700E-01f,
+            -9.250287100E-02f, -2.608431400E-02f, -4.136019900E-03f, -3.403403000E-04f,
+            -1.156489000E-05f, 0.0f,
+        },
+        {
+            0.000000000E+00f, 1.705703500E+01f, -2.330175900E-01f, 6.543558500E-03f,
+            -7.356274900E-05f, -1.789600100E-06f, 8.403616500E-08f, -1.373587900E-09f,
+            1.062982300E-11f, -3.244708700E-14f,
+        },
+        {
+            0.0f, 0.0f, 0.0f, 0.0f,
+            0.0f, 0.0f, 0.0f, 0.0f,
+            0.0f, 0.0f,
+        },
+    },
     {
-        *v = (float)(*raw) * 6.144f / 32768.0f;                           /* get convert adc */
-    }
-    else if (range == ADS1118_RANGE_4P096V)                               /* if 4.096V */
+        {
+            0.000000000E+00f, 3.843684700E+01f, 1.101048500E+00f, 5.222931200E+00f,
+            7.206052500E+00f, 5.848858600E+00f, 2.775491600E+00f, 7.707516600E-01f,
+            1.158266500E-01f, 7.313886800E-03f,
+        },
+        {
+            0.000000000E+00f, 3.868960000E+01f, -1.082670000E+00f, 4.702050000E-02f,
+            -2.121690000E-06f, -1.172720000E-04f, 5.392800000E-06f, -7.981560000E-08f,
+            0.0f, 0.0f,
+        },
+        {
+            1.972485000E+01f, 3.300943000E+01f, -3.915159000E-01f, 9.855391000E-03f,
+            -1.274371000E-04f, 7.767022000E-07f, 0.0f, 0.0f,
+            0.0f, 0.0f,
+        },
+    },
+};
+static const uint8_t gs_tc_inv_len[5][3] = {{9, 10, 7}, {9, 8, 6}, {8, 7, 0}, {9, 10, 0}, {10, 8, 6}};
+static const float gs_tc_inv_max[5][3] =
+{
+    {0.000f, 20.644f, 54.886f},
+    {0.000f, 42.919f, 69.553f},
+    {0.000f, 20.872f, 20.872f},
+    {0.000f, 76.373f, 76.373f},
+    {0.000f, 20.613f, 47.513f},
+};
+static const float gs_tc_inv_min[5] = {-5.891f, -8.095f, -5.603f, -8.825f, -3.990f};
+static const float gs_tc_inv_deg_min[5] = {-200.0f, -210.0f, -200.0f, -200.0f, -200.0f};
+
+/* ads1118_lut begin */
+/**
+ * @brief thermocouple lookup table definition
+ * @note  generated by project/simulator/src/lut.c from the nist polynomials, do not edit,
+ *        points are (temperature + 270C) * 16 at every 0.125mV from the base code of the type,
+ *        codes are emf in 1/2048 mV
+ */
+static const uint16_t gs_tc_lut[2422] =
+{
+    /* k type */
+     1007,  1137,  1261,  1375,  1482,  1583,  1680,  1772,  1860,  1945,  2028,  2108,
+     2186,  2261,  2335,  2408,  2478,  2548,  2616,  2682,  2748,  2813,  2876,  2939,
+     3001,  3062,  3122,  3182,  3241,  3299,  3357,  3414,  3470,  3526,  3582,  3637,
+     3692,  3746,  3800,  3853,  3906,  3959,  4012,  4064,  4115,  4167,  4218,  4269,
+     4320,  4371,  4421,  4471,  4521,  4571,  4621,  4670,  4720,  4769,  4818,  4867,
+     4916,  4965,  5014,  5063,  5111,  5160,  5208,  5256,  5305,  5353,  5401,  5449,
+     5497,  5545,  5594,  5642,  5690,  5738,  5786,  5835,  5883,  5931,  5980,  6028,
+     6076,  6125,  6174,  6222,  6271,  6320,  6369,  6418,  6467,  6517,  6566,  6616,
+     6665,  6715,  6764,  6814,  6864,  6914,  6964,  7014,  7064,  7114,  7164,  7214,
+     7264,  7314,  7364,  7414,  7465,  7515,  7565,  7615,  7665,  7714,  7764,  7814,
+     7864,  7914,  7963,  8013,  8062,  8112,  8161,  8210,  8260,  8309,  8358,  8407,
+     8456,  8505,  8554,  8603,  8651,  8700,  8749,  8797,  8846,  8894,  8943,  8991,
+     9039,  9088,  9136,  9184,  9232,  9281,  9329,  9377,  9425,  9473,  9521,  9569,
+     9617,  9665,  9712,  9760,  9808,  9856,  9904,  9951,  9999, 10047, 10094, 10142,
+    10189, 10237, 10285, 10332, 10380, 10427, 10475, 10522, 10569, 10617, 10664, 10712,
+    10759, 10806, 10854, 10901, 10948, 10995, 11043, 11090, 11137, 11184, 11231, 11279,
+    11326, 11373, 11420, 11467, 11514, 11561, 11608, 11655, 11702, 11749, 11796, 11843,
+    11890, 11937, 11984, 12031, 12078, 12125, 12172, 12219, 12266, 12313, 12360, 12407,
+    12453, 12500, 12547, 12594, 12641, 12688, 12735, 12782, 12829, 12876, 12922, 12969,
+    13016, 13063, 13110, 13157, 13204, 13251, 13298, 13345, 13392, 13439, 13486, 13532,
+    13579, 13626, 13673, 13720, 13767, 13814, 13861, 13909, 13956, 14003, 14050, 14097,
+    14144, 14191, 14238, 14285, 14333, 14380, 14427, 14474, 14521, 14569, 14616, 14663,
+    14711, 14758, 14805, 14853, 14900, 14948, 14995, 15042, 15090, 15137, 15185, 15233,
+    15280, 15328, 15375, 15423, 15471, 15518, 15566, 15614, 15662, 15710, 15757, 15805,
+    15853, 15901, 15949, 15997, 16045, 16093, 16141, 16190, 16238, 16286, 16334, 16382,
+    16431, 16479, 16527, 16576, 16624, 16673, 16721, 16770, 16818, 16867, 16915, 16964,
+    17013, 17061, 17110, 17159, 17208, 17257, 17305, 17354, 17403, 17452, 17501, 17550,
+    17600, 17649, 17698, 17747, 17796, 17846, 17895, 17944, 17994, 18043, 18093, 18142,
+    18192, 18241, 18291, 18341, 18391, 18440, 18490, 18540, 18590, 18640, 18690, 18740,
+    18790, 18840, 18890, 18940, 18990, 19040, 19091, 19141, 19191, 19242, 19292, 19343,
+    19393, 19444, 19494, 19545, 19596, 19646, 19697, 19748, 19799, 19850, 19901, 19951,
+    20002, 20054, 20105, 20156, 20207, 20258, 20309, 20361, 20412, 20464, 20515, 20567,
+    20618, 20670, 20721, 20773, 20825, 20877, 20928, 20980, 21032, 21084, 21136, 21188,
+    21240, 21292, 21345, 21397, 21449, 21502, 21554, 21607, 21659, 21712, 21764, 21817,
+    21870, 21923, 21976, 22028, 22081, 22134, 22188, 22241, 22294, 22347, 22401, 22454,
+    22507, 22561, 22615, 22668, 22722, 22776, 22830, 22884, 22937, 22992, 23046, 23100,
+    23154, 23209, 23263, 23317, 23372, 23427, 23481, 23536, 23591, 23646, 23701, 23756,
+    23811, 23866, 23922, 23977, 24033, 24088, 24144, 24200, 24256, 24312, 24368, 24424,
+    24480, 24536, 24592, 24649, 24705, 24762, 24819, 24876, 24933, 24990, 25047, 25104,
+    25161, 25218, 25276, 25333, 25391, 25449, 25507, 25565, 25623, 25681, 25739, 25797,
+    25856, 25914, 25973, 26031, 26090, 26149, 26208, 26267, 26327,
+    /* j type */
+      936,  1037,  1131,  1219,  1302,  1381,  1456,  1529,  1599,  1667,  1732,  1796,
+     1859,  1920,  1980,  2038,  2096,  2152,  2208,  2262,  2316,  2369,  2421,  2473,
+     2524,  2575,  2625,  2674,  2723,  2771,  2819,  2867,  2914,  2961,  3007,  3053,
+     3099,  3144,  3189,  3234,  3278,  3322,  3366,  3410,  3453,  3496,  3539,  3582,
+     3624,  3667,  3709,  3751,  3792,  3834,  3875,  3916,  3957,  3998,  4039,  4080,
+     4120,  4160,  4200,  4240,  4280,  4320,  4360,  4399,  4439,  4478,  4517,  4556,
+     4595,  4634,  4673,  4712,  4750,  4789,  4827,  4866,  4904,  4942,  4980,  5018,
+     5056,  5094,  5132,  5170,  5208,  5245,  5283,  5320,  5358,  5395,  5433,  5470,
+     5507,  5545,  5582,  5619,  5656,  5693,  5730,  5767,  5804,  5841,  5878,  5914,
+     5951,  5988,  6025,  6061,  6098,  6135,  6171,  6208,  6244,  6281,  6317,  6354,
+     6390,  6427,  6463,  6499,  6536,  6572,  6608,  6645,  6681,  6717,  6753,  6790,
+     6826,  6862,  6898,  6934,  6970,  7007,  7043,  7079,  7115,  7151,  7187,  7223,
+     7259,  7295,  7331,  7368,  7404,  7440,  7476,  7512,  7548,  7584,  7620,  7656,
+     7692,  7728,  7764,  7800,  7836,  7872,  7908,  7944,  7980,  8016,  8052,  8088,
+     8124,  8160,  8196,  8232,  8268,  8304,  8340,  8376,  8412,  8448,  8484,  8520,
+     8556,  8592,  8628,  8665,  8701,  8737,  8773,  8809,  8845,  8881,  8917,  8953,
+     8989,  9025,  9062,  9098,  9134,  9170,  9206,  9242,  9278,  9315,  9351,  9387,
+     9423,  9459,  9495,  9532,  9568,  9604,  9640,  9676,  9713,  9749,  9785,  9821,
+     9858,  9894,  9930,  9966, 10003, 10039, 10075, 10111, 10148, 10184, 10220, 10256,
+    10293, 10329, 10365, 10401, 10438, 10474, 10510, 10546, 10583, 10619, 10655, 10692,
+    10728, 10764, 10800, 10837, 10873, 10909, 10945, 10982, 11018, 11054, 11090, 11126,
+    11163, 11199, 11235, 11271, 11307, 11344, 11380, 11416, 11452, 11488, 11524, 11560,
+    11597, 11633, 11669, 11705, 11741, 11777, 11813, 11849, 11885, 11921, 11957, 11993,
+    12028, 12064, 12100, 12136, 12172, 12208, 12243, 12279, 12315, 12351, 12386, 12422,
+    12458, 12493, 12529, 12564, 12600, 12635, 12671, 12706, 12742, 12777, 12813, 12848,
+    12883, 12919, 12954, 12989, 13024, 13059, 13094, 13130, 13165, 13200, 13235, 13269,
+    13304, 13339, 13374, 13409, 13444, 13478, 13513, 13548, 13582, 13617, 13651, 13686,
+    13720, 13755, 13789, 13823, 13858, 13892, 13926, 13960, 13994, 14029, 14063, 14097,
+    14131, 14164, 14198, 14232, 14266, 14300, 14333, 14367, 14401, 14434, 14468, 14501,
+    14535, 14568, 14601, 14635, 14668, 14701, 14734, 14768, 14801, 14834, 14867, 14900,
+    14933, 14965, 14998, 15031, 15064, 15097, 15129, 15162, 15194, 15227, 15260, 15292,
+    15324, 15357, 15389, 15422, 15454, 15486, 15518, 15550, 15583, 15615, 15647, 15679,
+    15711, 15743, 15775, 15806, 15838, 15870, 15902, 15934, 15965, 15997, 16029, 16060,
+    16092, 16123, 16155, 16187, 16218, 16249, 16281, 16312, 16344, 16375, 16406, 16438,
+    16469, 16500, 16532, 16563, 16594, 16625, 16656, 16687, 16719, 16750, 16781, 16812,
+    16843, 16874, 16905, 16936, 16967, 16998, 17029, 17060, 17090, 17121, 17152, 17183,
+    17214, 17245, 17276, 17307, 17338, 17369, 17400, 17431, 17462, 17493, 17524, 17555,
+    17586, 17617, 17648, 17679, 17710, 17742, 17773, 17804, 17835, 17866, 17898, 17929,
+    17960, 17991, 18023, 18054, 18085, 18117, 18148, 18180, 18211, 18243, 18274, 18306,
+    18338, 18369, 18401, 18433, 18464, 18496, 18528, 18560, 18592, 18624, 18655, 18687,
+    18719, 18751, 18784, 18816, 18848, 18880, 18912, 18945, 18977, 19009, 19042, 19074,
+    19106, 19139, 19171, 19204, 19237, 19269, 19302, 19335, 19367, 19400, 19433, 19466,
+    19499, 19532, 19565, 19598, 19631, 19664, 19697, 19730, 19763, 19796, 19830, 19863,
+    19896, 19930, 19963, 19997, 20030, 20063, 20097, 20131, 20164, 20198, 20231, 20265,
+    20299, 20333, 20366, 20400, 20434, 20468, 20502, 20536, 20570, 20604, 20638, 20672,
+    20706, 20740, 20774, 20808, 20842, 20876, 20910, 20945, 20979, 21013, 21047, 21082,
+    21116, 21150, 21184, 21219, 21253, 21288, 21322, 21356, 21391, 21425, 21460, 21494,
+    21529, 21563, 21598, 21632, 21667, 21701, 21736, 21770, 21805, 21839, 21874, 21908,
+    21943, 21978, 22012, 22047, 22081, 22116, 22151, 22185, 22220, 22254, 22289, 22324,
+    22358, 22393, 22428, 22462, 22497, 22532, 22566, 22601, 22636, 22670, 22705, 22740,
+    22774, 22809, 22844, 22879, 22913, 22948, 22983, 23018, 23052, 23087, 23122, 23157,
+    23191, 23226, 23261, 23296, 23331, 23366, 23400, 23435, 23470, 23505, 23540,
+    /* t type */
+     1099,  1223,  1339,  1450,  1555,  1656,  1753,  1846,  1937,  2025,  2110,  2193,
+     2273,  2352,  2429,  2505,  2579,  2651,  2722,  2792,  2860,  2928,  2994,  3060,
+     3124,  3188,  3250,  3312,  3373,  3434,  3494,  3552,  3611,  3669,  3726,  3782,
+     3838,  3894,  3949,  4003,  4057,  4110,  4163,  4216,  4268,  4320,  4371,  4423,
+     4474,  4524,  4574,  4624,  4674,  4723,  4772,  4821,  4869,  4917,  4965,  5013,
+     5060,  5107,  5153,  5200,  5246,  5292,  5337,  5383,  5428,  5473,  5517,  5562,
+     5606,  5650,  5694,  5738,  5781,  5824,  5867,  5910,  5953,  5995,  6038,  6080,
+     6122,  6164,  6206,  6247,  6289,  6330,  6371,  6412,  6453,  6493,  6534,  6574,
+     6615,  6655,  6695,  6735,  6774,  6814,  6854,  6893,  6932,  6971,  7010,  7049,
+     7088,  7127,  7166,  7204,  7243,  7281,  7319,  7357,  7395,  7433,  7471,  7509,
+     7546,  7584,  7621,  7658,  7696,  7733,  7770,  7807,  7844,  7881,  7917,  7954,
+     7991,  8027,  8063,  8100,  8136,  8172,  8208,  8244,  8280,  8316,  8352,  8388,
+     8423,  8459,  8495,  8530,  8565,  8601,  8636,  8671,  8706,  8741,  8777,  8811,
+     8846,  8881,  8916,  8951,  8985,  9020,  9055,  9089,  9124,  9158,  9192,  9227,
+     9261,  9295,  9329,  9363,  9397,  9431,  9465,  9499,  9533,  9567,  9600,  9634,
+     9668,  9701,  9735,  9768,  9802,  9835,  9868,  9902,  9935,  9968, 10001, 10034,
+    10068, 10101, 10134, 10166, 10199, 10232, 10265, 10298, 10331, 10363, 10396, 10429,
+    10461, 10494, 10526, 10559, 10591, 10624, 10656, 10688, 10721,
+    /* e type */
+     1088,  1167,  1242,  1315,  1385,  1452,  1518,  1582,  1644,  1704,  1763,  1821,
+     1877,  1933,  1987,  2041,  2094,  2145,  2196,  2247,  2296,  2345,  2393,  2441,
+     2488,  2534,  2580,  2626,  2671,  2715,  2760,  2803,  2846,  2889,  2932,  2974,
+     3016,  3057,  3098,  3139,  3179,  3220,  3260,  3299,  3338,  3378,  3416,  3455,
+     3493,  3531,  3569,  3607,  3644,  3681,  3718,  3755,  3792,  3828,  3864,  3900,
+     3936,  3972,  4008,  4043,  4078,  4113,  4148,  4183,  4217,  4252,  4286,  4320,
+     4354,  4388,  4422,  4455,  4489,  4523,  4556,  4589,  4622,  4655,  4688,  4721,
+     4754,  4787,  4819,  4852,  4884,  4916,  4949,  4981,  5013,  5044,  5076,  5108,
+     5140,  5171,  5203,  5234,  5265,  5296,  5327,  5358,  5389,  5420,  5451,  5482,
+     5512,  5543,  5573,  5604,  5634,  5664,  5694,  5725,  5755,  5785,  5814,  5844,
+     5874,  5904,  5933,  5963,  5992,  6022,  6051,  6080,  6110,  6139,  6168,  6197,
+     6226,  6255,  6284,  6313,  6342,  6370,  6399,  6428,  6456,  6485,  6513,  6542,
+     6570,  6598,  6627,  6655,  6683,  6711,  6739,  6767,  6795,  6823,  6851,  6879,
+     6907,  6935,  6963,  6990,  7018,  7046,  7073,  7101,  7128,  7156,  7183,  7211,
+     7238,  7265,  7293,  7320,  7347,  7374,  7402,  7429,  7456,  7483,  7510,  7537,
+     7564,  7591,  7618,  7645,  7672,  7698,  7725,  7752,  7779,  7805,  7832,  7859,
+     7885,  7912,  7939,  7965,  7992,  8018,  8045,  8071,  8098,  8124,  8150,  8177,
+     8203,  8230,  8256,  8282,  8308,  8335,  8361,  8387,  8413,  8439,  8465,  8492,
+     8518,  8544,  8570,  8596,  8622,  8648,  8674,  8700,  8726,  8752,  8777,  8803,
+     8829,  8855,  8881,  8907,  8932,  8958,  8984,  9010,  9035,  9061,  9087,  9113,
+     9138,  9164,  9190,  9215,  9241,  9266,  9292,  9317,  9343,  9369,  9394,  9420,
+     9445,  9471,  9496,  9522,  9547,  9572,  9598,  9623,  9649,  9674,  9699,  9725,
+     9750,  9775,  9801,  9826,  9851,  9877,  9902,  9927,  9952,  9978, 10003, 10028,
+    10053, 10079, 10104, 10129, 10154, 10179, 10204, 10230, 10255, 10280, 10305, 10330,
+    10355, 10380, 10405, 10430, 10456, 10481, 10506, 10531, 10556, 10581, 10606, 10631,
+    10656, 10681, 10706, 10731, 10756, 10781, 10806, 10831, 10856, 10881, 10905, 10930,
+    10955, 10980, 11005, 11030, 11055, 11080, 11105, 11130, 11154, 11179, 11204, 11229,
+    11254, 11279, 11304, 11328, 11353, 11378, 11403, 11428, 11453, 11477, 11502, 11527,
+    11552, 11577, 11601, 11626, 11651, 11676, 11700, 11725, 11750, 11775, 11800, 11824,
+    11849, 11874, 11899, 11923, 11948, 11973, 11998, 12022, 12047, 12072, 12096, 12121,
+    12146, 12171, 12195, 12220, 12245, 12270, 12294, 12319, 12344, 12368, 12393, 12418,
+    12442, 12467, 12492, 12517, 12541, 12566, 12591, 12615, 12640, 12665, 12690, 12714,
+    12739, 12764, 12788, 12813, 12838, 12862, 12887, 12912, 12937, 12961, 12986, 13011,
+    13035, 13060, 13085, 13110, 13134, 13159, 13184, 13208, 13233, 13258, 13283, 13307,
+    13332, 13357, 13382, 13406, 13431, 13456, 13480, 13505, 13530, 13555, 13579, 13604,
+    13629, 13654, 13678, 13703, 13728, 13753, 13778, 13802, 13827, 13852, 13877, 13901,
+    13926, 13951, 13976, 14001, 14025, 14050, 14075, 14100, 14125, 14150, 14174, 14199,
+    14224, 14249, 14274, 14299, 14324, 14348, 14373, 14398, 14423, 14448, 14473, 14498,
+    14523, 14547, 14572, 14597, 14622, 14647, 14672, 14697, 14722, 14747, 14772, 14797,
+    14822, 14847, 14872, 14897, 14922, 14946, 14971, 14996, 15021, 15046, 15071, 15096,
+    15121, 15147, 15172, 15197, 15222, 15247, 15272, 15297, 15322, 15347, 15372, 15397,
+    15422, 15447, 15472, 15497, 15523, 15548, 15573, 15598, 15623, 15648, 15673, 15698,
+    15724, 15749, 15774, 15799, 15824, 15849, 15875, 15900, 15925, 15950, 15975, 16001,
+    16026, 16051, 16076, 16102, 16127, 16152, 16177, 16203, 16228, 16253, 16279, 16304,
+    16329, 16354, 16380, 16405, 16430, 16456, 16481, 16506, 16532, 16557, 16582, 16608,
+    16633, 16659, 16684, 16709, 16735, 16760, 16786, 16811, 16836, 16862, 16887, 16913,
+    16938, 16964, 16989, 17015, 17040, 17065, 17091, 17116, 17142, 17167, 17193, 17219,
+    17244, 17270, 17295, 17321, 17346, 17372, 17397, 17423, 17449, 17474, 17500, 17525,
+    17551, 17577, 17602, 17628, 17653, 17679, 17705, 17730, 17756, 17782, 17808, 17833,
+    17859, 17885, 17910, 17936, 17962, 17988, 18013, 18039, 18065, 18091, 18116, 18142,
+    18168, 18194, 18220, 18246, 18271, 18297, 18323, 18349, 18375, 18401, 18427, 18453,
+    18479, 18505, 18530, 18556, 18582, 18608, 18634, 18660, 18686, 18712, 18738, 18764,
+    18791, 18817, 18843, 18869, 18895, 18921, 18947, 18973, 18999, 19025, 19052, 19078,
+    19104, 19130, 19156, 19183, 19209, 19235, 19261, 19288, 19314, 19340, 19367, 19393,
+    19419, 19446, 19472, 19498, 19525, 19551, 19578, 19604, 19630, 19657, 19683, 19710,
+    19736, 19763, 19789, 19816, 19842, 19869, 19895, 19922, 19948, 19975, 20001, 20028,
+    20054, 20081, 20108, 20134, 20161, 20187, 20214, 20241, 20267, 20294, 20320,
+    /* n type */
+     1106,  1293,  1460,  1611,  1750,  1881,  2005,  2122,  2235,  2343,  2448,  2549,
+     2648,  2744,  2838,  2930,  3020,  3109,  3196,  3282,  3366,  3450,  3532,  3614,
+     3695,  3775,  3854,  3933,  4011,  4089,  4166,  4243,  4320,  4397,  4473,  4549,
+     4625,  4700,  4774,  4849,  4922,  4995,  5068,  5140,  5212,  5283,  5354,  5425,
+     5495,  5565,  5634,  5703,  5771,  5839,  5907,  5974,  6041,  6108,  6174,  6240,
+     6306,  6371,  6436,  6501,  6566,  6630,  6694,  6757,  6821,  6884,  6946,  7009,
+     7071,  7133,  7195,  7257,  7318,  7380,  7441,  7501,  7562,  7622,  7683,  7743,
+     7802,  7862,  7921,  7981,  8040,  8099,  8158,  8216,  8275,  8333,  8391,  8449,
+     8507,  8565,  8623,  8680,  8737,  8795,  8852,  8909,  8965,  9022,  9079,  9135,
+     9192,  9248,  9304,  9360,  9416,  9472,  9528,  9583,  9639,  9694,  9750,  9805,
+     9860,  9915,  9970, 10025, 10080, 10134, 10189, 10244, 10298, 10353, 10407, 10461,
+    10515, 10569, 10623, 10677, 10731, 10785, 10839, 10893, 10946, 11000, 11053, 11107,
+    11160, 11213, 11267, 11320, 11373, 11426, 11479, 11532, 11585, 11638, 11691, 11743,
+    11796, 11849, 11902, 11954, 12007, 12059, 12112, 12164, 12216, 12269, 12321, 12373,
+    12425, 12477, 12530, 12582, 12634, 12686, 12738, 12790, 12842, 12893, 12945, 12997,
+    13049, 13101, 13152, 13204, 13256, 13307, 13359, 13410, 13462, 13514, 13565, 13616,
+    13668, 13719, 13771, 13822, 13874, 13925, 13976, 14028, 14079, 14130, 14181, 14233,
+    14284, 14335, 14386, 14437, 14488, 14540, 14591, 14642, 14693, 14744, 14795, 14846,
+    14897, 14948, 14999, 15050, 15101, 15152, 15203, 15254, 15305, 15356, 15407, 15458,
+    15509, 15560, 15611, 15662, 15713, 15764, 15815, 15866, 15917, 15967, 16018, 16069,
+    16120, 16171, 16222, 16273, 16324, 16375, 16426, 16477, 16527, 16578, 16629, 16680,
+    16731, 16782, 16833, 16884, 16935, 16986, 17037, 17088, 17139, 17189, 17240, 17291,
+    17342, 17393, 17444, 17495, 17546, 17597, 17648, 17699, 17750, 17801, 17852, 17903,
+    17954, 18006, 18057, 18108, 18159, 18210, 18261, 18312, 18363, 18414, 18466, 18517,
+    18568, 18619, 18670, 18722, 18773, 18824, 18875, 18927, 18978, 19029, 19081, 19132,
+    19183, 19235, 19286, 19337, 19389, 19440, 19492, 19543, 19595, 19646, 19698, 19749,
+    19801, 19852, 19904, 19956, 20007, 20059, 20111, 20162, 20214, 20266, 20318, 20370,
+    20421, 20473, 20525, 20577, 20629, 20681, 20733, 20785, 20837, 20889, 20941, 20993,
+    21045, 21097, 21150, 21202, 21254, 21306, 21359, 21411, 21463, 21516, 21568, 21621,
+    21673, 21726, 21778, 21831, 21884, 21936, 21989, 22042, 22094, 22147, 22200, 22253,
+    22306, 22359, 22412, 22465, 22518, 22571, 22624, 22677, 22730, 22783, 22837, 22890,
+    22943, 22997, 23050, 23103, 23157, 23210, 23264, 23318, 23371, 23425, 23479, 23532,
+    23586, 23640, 23694, 23748, 23802, 23856, 23910, 23964, 24018, 24073, 24127, 24181,
+    24236, 24290, 24345, 24399, 24454, 24508, 24563, 24618, 24673, 24728, 24783, 24838,
+    24893, 24948, 25004, 25059, 25114, 25170,
+};
+static const uint16_t gs_tc_lut_start[5] = {0, 489, 1112, 1325, 2008};
+static const int32_t gs_tc_lut_base[5] = {-12288, -16640, -11520, -18176, -8192};
+static const int32_t gs_tc_lut_min[5] = {-12065, -16579, -11476, -18072, -8172};
+static const int32_t gs_tc_lut_max[5] = {112407, 142444, 42745, 156411, 97305};
+/* ads1118_lut end */
+
+/**
+ * @brief thermocouple lookup scale definition
+ * @note  lsb of every range in 1/2048 mV
+ */
+static const int32_t gs_tc_lut_scale[6] = {384, 256, 128, 64, 32, 16};
+
+/**
+ * @brief     evaluate a polynomial
+ * @param[in] *c pointer to a coefficient buffer from the constant term
+ * @param[in] n coefficient number
+ * @param[in] x variable
+ * @return    polynomial value
+ * @note      horner form
+ */
+static float a_ads1118_tc_poly(const float *c, uint8_t n, float x)
+{
+    float r;
+    
+    r = c[n - 1];                                                                         /* highest term */
+    while (n > 1)                                                                         /* run all terms */
     {
-        *v = (float)(*raw) * 4.096f / 32768.0f;                           /* get convert adc */
+        n--;                                                                              /* next term */
+        r = r * x + c[n - 1];                                                             /* horner step */
     }
-    else if (range == ADS1118_RANGE_2P048V)                               /* if 2.048V */
+    
+    return r;                                                                             /* return the value */
+}
+
+/**
+ * @brief     convert a temperature to the thermocouple emf
+ * @param[in] type thermocouple type
+ * @param[in] deg temperature
+ * @return    emf in mV
+ * @note      deg must be in the range of the type
+ */
+static float a_ads1118_tc_deg_to_mv(uint8_t type, float deg)
+{
+    uint8_t i;
+    float mv;
+    float d;
+    
+    i = (deg > gs_tc_fwd_split[type]) ? 1 : 0;                                            /* select the segment */
+    mv = a_ads1118_tc_poly(gs_tc_fwd_coef[type][i], gs_tc_fwd_len[type][i], deg);         /* evaluate */
+    if ((type == ADS1118_THERMOCOUPLE_TYPE_K) && (i == 1))                                /* k type above 0C */
     {
-        *v = (float)(*raw) * 2.048f / 32768.0f;                           /* get convert adc */
+        d = deg - gs_tc_k_exp[2];                                                         /* distance to the center */
+        mv += gs_tc_k_exp[0] * expf(gs_tc_k_exp[1] * d * d);                              /* add the exponential term */
     }
-    else if (range == ADS1118_RANGE_1P024V)                               /* if 1.024V */
+    
+    return mv;                                                                            /* return the emf */
+}
+
+/**
+ * @brief      convert a thermocouple emf to the temperature
+ * @param[in]  type thermocouple type
+ * @param[in]  mv emf in mV
+ * @param[out] *deg pointer to a deg buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 mv is out of range
+ * @note       an out of range emf gives the temperature limit of the table
+ */
+static uint8_t a_ads1118_tc_mv_to_deg(uint8_t type, float mv, float *deg)
+{
+    uint8_t i;
+    
+    if (mv < gs_tc_inv_min[type])                                                         /* check the min */
     {
-        *v = (float)(*raw) * 1.024f / 32768.0f;                           /* get convert adc */
+        *deg = gs_tc_inv_deg_min[type];                                                   /* clamp to the min */
+        
+        return 1;                                                                         /* return error */
     }
-    else if (range == ADS1118_RANGE_0P512V)                               /* if 0.512V */
+    if (mv > gs_tc_inv_max[type][2])                                                      /* check the max */
     {
-        *v = (float)(*raw) * 0.512f / 32768.0f;                           /* get convert adc */
+        *deg = gs_tc_fwd_max[type];                                                       /* clamp to the max */
+        
+        return 1;                                                                         /* return error */
     }
-    else if (range == ADS1118_RANGE_0P256V)                               /* if 0.256V */
+    i = 0;                                                                                /* first segment */
+    while (mv > gs_tc_inv_max[type][i])                                                   /* find the segment */
     {
-        *v = (float)(*raw) * 0.256f / 32768.0f;                           /* get convert adc */
+        i++;                                                                              /* next segment */
     }
-    else
+    *deg = a_ads1118_tc_poly(gs_tc_inv_coef[type][i], gs_tc_inv_len[type][i], mv);        /* evaluate */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     convert an emf to the lookup code
+ * @param[in] mv emf in mV
+ * @return    emf in 1/2048 mV
+ * @note      none
+ */
+static int32_t a_ads1118_tc_code(float mv)
+{
+    float x;
+    
+    x = mv * 2048.0f;                                                                     /* scale to the code */
+    if (x < 0.0f)                                                                         /* if negative */
     {
-        handle->debug_print("ads1118: range is invalid.\n");              /* range is invalid */
-        
-        return 1;                                                         /* return error */
+        return (int32_t)(x - 0.5f);                                                       /* round half away from zero */
     }
     
-    return 0;                                                             /* success return 0 */
+    return (int32_t)(x + 0.5f);                                                           /* round half away from zero */
 }
 
 /**
- * @brief      read data from the chip continuously
+ * @brief      handle a result of the thermocouple pipeline
  * @param[in]  *handle pointer to an ads1118 handle structure
- * @param[out] *raw pointer to a raw adc buffer
- * @param[out] *v pointer to a converted adc buffer
+ * @param[in]  *tc pointer to an ads1118 thermocouple structure
+ * @param[in]  conf config of the conversion
+ * @param[in]  raw conversion result
+ * @param[out] *deg pointer to a deg buffer
  * @return     status code
  *             - 0 success
- *             - 1 continuous read failed
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       this function can be used only after run ads1118_start_continuous_read
- *             and can be stopped by ads1118_stop_continuous_read
+ *             - 1 temperature is out of range or convert failed
+ * @note       a temperature sensor result refreshes the cold junction cache and writes no deg,
+ *             a thermocouple result is corrected by the calibration of the handle
  */
-uint8_t ads1118_continuous_read(ads1118_handle_t *handle, int16_t *raw, float *v)
+static uint8_t a_ads1118_tc_result(ads1118_handle_t *handle, ads1118_thermocouple_t *tc, uint16_t conf,
+                                   int16_t raw, float *deg)
 {
-    uint8_t res;
-    uint8_t range;
-    uint16_t conf;
+    int32_t uv;
+    float mv;
     
-    if (handle == NULL)                                                   /* check handle */
+    if ((conf & (1 << 4)) != 0)                                                           /* if temperature mode */
     {
-        return 2;                                                         /* return error */
+        tc->cj_deg = (float)(raw) * 0.03125f / 4.0f;                                      /* convert to deg */
+        tc->cj_mv = a_ads1118_tc_deg_to_mv((uint8_t)tc->type, tc->cj_deg);                /* get the cold junction emf */
+        tc->cj_code = a_ads1118_tc_code(tc->cj_mv);                                       /* get the lookup code */
+        tc->cj_valid = 1;                                                                 /* flag the cache */
+        
+        return 0;                                                                         /* success return 0 */
     }
-    if (handle->inited != 1)                                              /* check handle initialization */
+    a_ads1118_calibrate_raw(handle, conf, &raw);                                          /* correct the code */
+    if (ads1118_raw_to_microvolts(tc->range, raw, &uv) != 0)                              /* convert to uV */
     {
-        return 3;                                                         /* return error */
+        return 1;                                                                         /* return error */
     }
+    mv = (float)uv * 0.001f + tc->cj_mv;                                                  /* compensate */
     
-    res = a_ads1118_spi_read(handle, (uint16_t *)&conf);                  /* read config */
-    if (res != 0)                                                         /* check error */
+    return a_ads1118_tc_mv_to_deg((uint8_t)tc->type, mv, deg);                            /* linearize */
+}
+
+/**
+ * @brief     initialize a thermocouple pipeline
+ * @param[in] *tc pointer to an ads1118 thermocouple structure
+ * @param[in] type thermocouple type
+ * @param[in] channel differential channel of the thermocouple
+ * @param[in] range adc range
+ * @param[in] rate adc rate
+ * @param[in] ratio thermocouple conversions per cold junction conversion
+ * @return    status code
+ *            - 0 success
+ *            - 2 tc is NULL
+ *            - 4 type is invalid
+ *            - 5 range is invalid
+ *            - 6 ratio is invalid
+ * @note      the cold junction cache is empty, so the first read starts with a temperature sensor conversion,
+ *            0.256V covers every type up to its max temperature with the cold junction at 0C
+ */
+uint8_t ads1118_thermocouple_init(ads1118_thermocouple_t *tc, ads1118_thermocouple_type_t type,
+                                  ads1118_channel_t channel, ads1118_range_t range,
+                                  ads1118_rate_t rate, uint16_t ratio)
+{
+    if (tc == NULL)                                                                       /* check tc */
     {
-        handle->debug_print("ads1118: read config failed.\n");            /* read config failed */
-        
-        return 1;                                                         /* return error */
+        return 2;                                                                         /* return error */
     }
-    range = (ads1118_range_t)((conf >> 9) & 0x07);                        /* get range conf */
-    res = a_ads1118_spi_read_data(handle, raw);                           /* read data */
-    if (res != 0)                                                         /* check error */
+    if (type > ADS1118_THERMOCOUPLE_TYPE_N)                                               /* check type */
     {
-        handle->debug_print("ads1118: continuous read failed.\n");        /* continuous read failed */
-        
-        return 1;                                                         /* return error */
+        return 4;                                                                         /* return error */
     }
-    if (range == ADS1118_RANGE_6P144V)                                    /* if 6.144V */
+    if (range > ADS1118_RANGE_0P256V)                                                     /* check range */
     {
-        *v = (float)(*raw) * 6.144f / 32768.0f;                           /* get convert adc */
+        return 5;                                                                         /* return error */
     }
-    else if (range == ADS1118_RANGE_4P096V)                               /* if 4.096V */
+    if (ratio == 0)                                                                       /* check ratio */
     {
-        *v = (float)(*raw) * 4.096f / 32768.0f;                           /* get convert adc */
+        return 6;                                                                         /* return error */
     }
-    else if (range == ADS1118_RANGE_2P048V)                               /* if 2.048V */
+    
+    tc->type = type;                                                                      /* set type */
+    tc->channel = channel;                                                                /* set channel */
+    tc->range = range;                                                                    /* set range */
+    tc->rate = rate;                                                                      /* set rate */
+    tc->ratio = ratio;                                                                    /* set ratio */
+    tc->count = ratio;                                                                    /* start with the cold junction */
+    tc->cj_deg = 0.0f;                                                                    /* no cold junction */
+    tc->cj_mv = 0.0f;                                                                     /* no cold junction emf */
+    tc->cj_code = 0;                                                                      /* no cold junction code */
+    tc->cj_valid = 0;                                                                     /* empty cache */
+    tc->inited = 1;                                                                       /* flag inited */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     set the cold junction temperature
+ * @param[in] *tc pointer to an ads1118 thermocouple structure
+ * @param[in] deg cold junction temperature
+ * @return    status code
+ *            - 0 success
+ *            - 2 tc is NULL
+ *            - 3 tc is not initialized
+ *            - 4 deg is out of range
+ * @note      the value is cached as a fresh temperature sensor result,
+ *            so the next ratio thermocouple conversions use it
+ */
+uint8_t ads1118_thermocouple_set_cold_junction(ads1118_thermocouple_t *tc, float deg)
+{
+    if (tc == NULL)                                                                       /* check tc */
     {
-        *v = (float)(*raw) * 2.048f / 32768.0f;                           /* get convert adc */
+        return 2;                                                                         /* return error */
     }
-    else if (range == ADS1118_RANGE_1P024V)                               /* if 1.024V */
+    if (tc->inited != 1)                                                                  /* check tc initialization */
     {
-        *v = (float)(*raw) * 1.024f / 32768.0f;                           /* get convert adc */
+        return 3;                                                                         /* return error */
     }
-    else if (range == ADS1118_RANGE_0P512V)                               /* if 0.512V */
+    if ((deg < gs_tc_fwd_min[tc->type]) || (deg > gs_tc_fwd_max[tc->type]))               /* check deg */
     {
-        *v = (float)(*raw) * 0.512f / 32768.0f;                           /* get convert adc */
+        return 4;                                                                         /* return error */
     }
-    else if (range == ADS1118_RANGE_0P256V)                               /* if 0.256V */
+    
+    tc->cj_deg = deg;                                                                     /* set the cold junction */
+    tc->cj_mv = a_ads1118_tc_deg_to_mv((uint8_t)tc->type, deg);                           /* get the cold junction emf */
+    tc->cj_code = a_ads1118_tc_code(tc->cj_mv);                                           /* get the lookup code */
+    tc->cj_valid = 1;                                                                     /* flag the cache */
+    tc->count = 0;                                                                        /* fresh cold junction */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      get the cached cold junction temperature
+ * @param[in]  *tc pointer to an ads1118 thermocouple structure
+ * @param[out] *deg pointer to a deg buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 tc is NULL
+ *             - 3 tc is not initialized
+ *             - 4 no cold junction temperature is cached
+ * @note       none
+ */
+uint8_t ads1118_thermocouple_get_cold_junction(ads1118_thermocouple_t *tc, float *deg)
+{
+    if (tc == NULL)                                                                       /* check tc */
     {
-        *v = (float)(*raw) * 0.256f / 32768.0f;                           /* get convert adc */
+        return 2;                                                                         /* return error */
     }
-    else
+    if (tc->inited != 1)                                                                  /* check tc initialization */
     {
-        handle->debug_print("ads1118: range is invalid.\n");              /* range is invalid */
-        
-        return 1;                                                         /* return error */
+        return 3;                                                                         /* return error */
+    }
+    if (tc->cj_valid == 0)                                                                /* check the cache */
+    {
+        return 4;                                                                         /* return error */
     }
     
-    return 0;                                                             /* success return 0 */
+    *deg = tc->cj_deg;                                                                    /* get the cold junction */
+    
+    return 0;                                                                             /* success return 0 */
 }
 
 /**
- * @brief     start the chip reading
- * @param[in] *handle pointer to an ads1118 handle structure
- * @return    status code
- *            - 0 success
- *            - 1 start continuous read failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      read a block of compensated thermocouple temperatures
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  *tc pointer to an ads1118 thermocouple structure
+ * @param[out] *deg pointer to a deg buffer
+ * @param[in]  len buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 thermocouple read failed
+ *             - 2 handle or tc is NULL
+ *             - 3 handle or tc is not initialized
+ *             - 4 len is invalid
+ *             - 5 a temperature is out of range
+ * @note       the chip runs single shot conversions like ads1118_scan, every frame starts the next conversion
+ *             and reads the last one, so the mode switch costs no extra frame,
+ *             one temperature sensor conversion is put in front of every ratio thermocouple conversions,
+ *             each thermocouple result is converted with the cached cold junction during the next conversion,
+ *             an out of range result is clamped to the table limit and the block is still read to the end,
+ *             the config shadow keeps the thermocouple slot at the end
  */
-uint8_t ads1118_start_continuous_read(ads1118_handle_t *handle)
+uint8_t ads1118_thermocouple_read(ads1118_handle_t *handle, ads1118_thermocouple_t *tc, float *deg, uint16_t len)
 {
     uint8_t res;
+    uint8_t status;
+    uint8_t busy;
+    uint16_t started;
+    uint16_t done;
     uint16_t conf;
+    uint16_t tc_conf;
+    int16_t raw;
     
-    if (handle == NULL)                                                /* check handle */
+    if ((handle == NULL) || (tc == NULL))                                                 /* check handle and tc */
     {
-        return 2;                                                      /* return error */
+        return 2;                                                                         /* return error */
     }
-    if (handle->inited != 1)                                           /* check handle initialization */
+    if ((handle->inited != 1) || (tc->inited != 1))                                       /* check initialization */
     {
-        return 3;                                                      /* return error */
+        return 3;                                                                         /* return error */
+    }
+    if (len == 0)                                                                         /* check length */
+    {
+        handle->debug_print("ads1118: len is invalid.\n");                                /* len is invalid */
+        
+        return 4;                                                                         /* return error */
     }
     
-    res = a_ads1118_spi_read(handle, (uint16_t *)&conf);               /* read config */
-    if (res != 0)                                                      /* check error */
+    SET_API(handle, ADS1118_API_THERMOCOUPLE_READ);                                       /* set the running api */
+    tc_conf = handle->conf;                                                               /* get config */
+    tc_conf &= ~(0x07 << 12);                                                             /* clear channel bits */
+    tc_conf |= (uint16_t)((tc->channel & 0x07) << 12);                                    /* set channel */
+    tc_conf &= ~(0x07 << 9);                                                              /* clear range bits */
+    tc_conf |= (uint16_t)((tc->range & 0x07) << 9);                                       /* set range */
+    tc_conf &= ~(0x07 << 5);                                                              /* clear rate bits */
+    tc_conf |= (uint16_t)((tc->rate & 0x07) << 5);                                        /* set rate */
+    tc_conf &= ~(1 << 4);                                                                 /* set the adc mode */
+    tc_conf |= 1 << 8;                                                                    /* set single read */
+    status = 0;                                                                           /* no range error */
+    busy = 0;                                                                             /* no conversion is running */
+    started = 0;                                                                          /* no thermocouple conversion */
+    done = 0;                                                                             /* no output */
+    while (started < len)                                                                 /* start all thermocouple conversions */
     {
-        handle->debug_print("ads1118: read config failed.\n");         /* read config failed */
+        if (tc->count >= tc->ratio)                                                       /* time for the cold junction */
+        {
+            conf = tc_conf | (1 << 4);                                                    /* temperature sensor slot */
+            tc->count = 0;                                                                /* restart the count */
+        }
+        else
+        {
+            conf = tc_conf;                                                               /* thermocouple slot */
+            tc->count++;                                                                  /* count the conversion */
+            started++;                                                                    /* one more started */
+        }
+        res = a_ads1118_spi_write_read_data(handle, conf | (1 << 15), &raw);              /* start and read the last one */
+        if (res != 0)                                                                     /* check error */
+        {
+            handle->debug_print("ads1118: convert and fetch failed.\n");                  /* convert and fetch failed */
+            
+            return 1;                                                                     /* return error */
+        }
+        if (busy != 0)                                                                    /* skip the stale result */
+        {
+            status |= a_ads1118_tc_result(handle, tc, handle->conf, raw, &deg[done]);     /* convert during the conversion */
+            if ((handle->conf & (1 << 4)) == 0)                                           /* if a thermocouple result */
+            {
+                done++;                                                                   /* one more output */
+            }
+        }
+        handle->conf = conf;                                                              /* save config */
+        busy = 1;                                                                         /* a conversion is running */
+        res = a_ads1118_wait_conversion(handle, tc->rate);                                /* wait conversion */
+        if (res != 0)                                                                     /* check the result */
+        {
+            return 1;                                                                     /* return error */
+        }
+    }
+    res = a_ads1118_spi_read_data(handle, &raw);                                          /* read the last one */
+    if (res != 0)                                                                         /* check error */
+    {
+        handle->debug_print("ads1118: read data failed.\n");                              /* read data failed */
         
-        return 1;                                                      /* return error */
+        return 1;                                                                         /* return error */
     }
-    conf &= ~(0x01 << 8);                                              /* set start continuous read */
-    res = a_ads1118_spi_write(handle, conf);                           /* write config */
-    if (res != 0)                                                      /* check error */
+    status |= a_ads1118_tc_result(handle, tc, handle->conf, raw, &deg[done]);             /* convert */
+    STATS_ADD(handle, samples, len);                                                      /* count the samples */
+    if (status != 0)                                                                      /* check the range */
     {
-        handle->debug_print("ads1118: write config failed.\n");        /* write config failed */
+        handle->debug_print("ads1118: temperature is out of range.\n");                   /* temperature is out of range */
         
-        return 1;                                                      /* return error */
+        return 5;                                                                         /* return error */
     }
     
-    return 0;                                                          /* success return 0 */
+    return 0;                                                                             /* success return 0 */
 }
 
 /**
- * @brief     stop the chip reading
- * @param[in] *handle pointer to an ads1118 handle structure
- * @return    status code
- *            - 0 success
- *            - 1 stop continuous read failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      convert a microvolt block to compensated temperatures
+ * @param[in]  *tc pointer to an ads1118 thermocouple structure
+ * @param[in]  *uv pointer to a thermocouple microvolt buffer
+ * @param[out] *deg pointer to a deg buffer
+ * @param[in]  n buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 2 tc is NULL
+ *             - 3 tc is not initialized
+ *             - 4 no cold junction temperature is cached
+ *             - 5 a temperature is out of range
+ * @note       uv can come from ads1118_raw_to_microvolts of a continuous block,
+ *             every sample uses the cached cold junction
  */
-uint8_t ads1118_stop_continuous_read(ads1118_handle_t *handle)
+uint8_t ads1118_thermocouple_convert_n(ads1118_thermocouple_t *tc, const int32_t *uv, float *deg, uint32_t n)
 {
-    uint8_t res;
-    uint16_t conf;
+    uint8_t status;
+    uint32_t i;
+    float mv;
     
-    if (handle == NULL)                                                /* check handle */
+    if (tc == NULL)                                                                       /* check tc */
     {
-        return 2;                                                      /* return error */
+        return 2;                                                                         /* return error */
     }
-    if (handle->inited != 1)                                           /* check handle initialization */
+    if (tc->inited != 1)                                                                  /* check tc initialization */
     {
-        return 3;                                                      /* return error */
+        return 3;                                                                         /* return error */
+    }
+    if (tc->cj_valid == 0)                                                                /* check the cache */
+    {
+        return 4;                                                                         /* return error */
     }
     
-    res = a_ads1118_spi_read(handle, (uint16_t *)&conf);               /* read config */
-    if (res != 0)                                                      /* check error */
+    status = 0;                                                                           /* no range error */
+    for (i = 0; i < n; i++)                                                               /* run all samples */
     {
-        handle->debug_print("ads1118: read config failed.\n");         /* read config failed */
-        
-        return 1;                                                      /* return error */
+        mv = (float)uv[i] * 0.001f + tc->cj_mv;                                           /* compensate */
+        status |= a_ads1118_tc_mv_to_deg((uint8_t)tc->type, mv, &deg[i]);                 /* linearize */
     }
-    conf &= ~(0x01 << 8);                                              /* clear bit */
-    conf |= 1 << 8;                                                    /* set stop continues read */
-    res = a_ads1118_spi_write(handle, conf);                           /* write config */
-    if (res != 0)                                                      /* check error */
+    if (status != 0)                                                                      /* check the range */
     {
-        handle->debug_print("ads1118: write config failed.\n");        /* write config failed */
-        
-        return 1;                                                      /* return error */
+        return 5;                                                                         /* return error */
     }
     
-    return 0;                                                          /* success return 0 */
+    return 0;                                                                             /* success return 0 */
 }
 
 /**
- * @brief      temperature convert
- * @param[in]  *handle pointer to an ads1118 handle structure
- * @param[in]  raw adc raw data
- * @param[out] *deg pointer to a deg buffer
+ * @brief      convert a raw block to compensated temperatures with the lookup table
+ * @param[in]  *tc pointer to an ads1118 thermocouple structure
+ * @param[in]  *raw pointer to a thermocouple raw buffer
+ * @param[out] *mdeg pointer to a temperature buffer in 0.001C
+ * @param[in]  n buffer length
  * @return     status code
  *             - 0 success
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
+ *             - 2 tc is NULL
+ *             - 3 tc is not initialized
+ *             - 4 no cold junction temperature is cached
+ *             - 5 a temperature is out of range
+ * @note       raw is read with the range of tc, the code is scaled to 1/2048 mV, the cold junction emf is added
+ *             and the temperature is interpolated between nist points of 0.125mV with integer math only,
+ *             the table error is below 0.25C over the range of ads1118_thermocouple_mv_to_deg,
+ *             an out of range temperature is clamped to the table limit,
+ *             correct raw with ads1118_calibrate_n before if the calibration is used
  */
-uint8_t ads1118_temperature_convert(ads1118_handle_t *handle, int16_t raw, float *deg)
+uint8_t ads1118_thermocouple_raw_to_mdeg_n(ads1118_thermocouple_t *tc, const int16_t *raw, int32_t *mdeg, uint32_t n)
 {
-    if (handle == NULL)                           /* check handle */
+    uint8_t status;
+    uint32_t i;
+    int32_t scale;
+    int32_t cj;
+    int32_t lo;
+    int32_t hi;
+    int32_t base;
+    int32_t q;
+    int32_t t;
+    int32_t y0;
+    int32_t y1;
+    const uint16_t *lut;
+    
+    if (tc == NULL)                                                                       /* check tc */
     {
-        return 2;                                 /* return error */
+        return 2;                                                                         /* return error */
     }
-    if (handle->inited != 1)                      /* check handle initialization */
+    if (tc->inited != 1)                                                                  /* check tc initialization */
     {
-        return 3;                                 /* return error */
+        return 3;                                                                         /* return error */
+    }
+    if (tc->cj_valid == 0)                                                                /* check the cache */
+    {
+        return 4;                                                                         /* return error */
     }
     
-    *deg = (float)(raw) * 0.03125f / 4.0f;        /* convert to deg */
+    scale = gs_tc_lut_scale[tc->range];                                                   /* get the lsb of the range */
+    cj = tc->cj_code;                                                                     /* get the cold junction code */
+    lo = gs_tc_lut_min[tc->type];                                                         /* get the min code */
+    hi = gs_tc_lut_max[tc->type];                                                         /* get the max code */
+    base = gs_tc_lut_base[tc->type];                                                      /* get the code of the first point */
+    lut = &gs_tc_lut[gs_tc_lut_start[tc->type]];                                          /* get the table of the type */
+    status = 0;                                                                           /* no range error */
+    for (i = 0; i < n; i++)                                                               /* run all samples */
+    {
+        q = (int32_t)raw[i] * scale + cj;                                                 /* compensate in 1/2048 mV */
+        if (q < lo)                                                                       /* check the min */
+        {
+            q = lo;                                                                       /* clamp to the min */
+            status = 1;                                                                   /* flag the range error */
+        }
+        if (q > hi)                                                                       /* check the max */
+        {
+            q = hi;                                                                       /* clamp to the max */
+            status = 1;                                                                   /* flag the range error */
+        }
+        q -= base;                                                                        /* offset from the first point */
+        y0 = (int32_t)lut[q >> 8];                                                        /* point below */
+        y1 = (int32_t)lut[(q >> 8) + 1];                                                  /* point above */
+        t = y0 * 256 + (y1 - y0) * (q & 0xFF);                                            /* interpolate in 1/4096 C */
+        mdeg[i] = ((t * 125 + 256) >> 9) - 270000;                                        /* scale to 0.001C and remove the offset */
+    }
+    if (status != 0)                                                                      /* check the range */
+    {
+        return 5;                                                                         /* return error */
+    }
     
-    return 0;                                     /* success return 0 */
+    return 0;                                                                             /* success return 0 */
 }
 
 /**
- * @brief      chip transmit
- * @param[in]  *handle pointer to an ads1118 handle structure
- * @param[in]  *tx pointer to a tx buffer
- * @param[out] *rx pointer to a rx buffer
- * @param[in]  len length of tx and rx buffer
+ * @brief      convert a temperature to the thermocouple emf
+ * @param[in]  type thermocouple type
+ * @param[in]  deg temperature
+ * @param[out] *mv pointer to an emf buffer in mV
  * @return     status code
  *             - 0 success
- *             - 1 transmit failed
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
+ *             - 1 type is invalid
+ *             - 4 deg is out of range
+ * @note       nist its-90 reference polynomials, the k type has the exponential term above 0C,
+ *             the range is -270C to the max temperature of the type, -210C for the j type
  */
-uint8_t ads1118_transmit(ads1118_handle_t *handle, uint8_t *tx, uint8_t *rx, uint16_t len)
+uint8_t ads1118_thermocouple_deg_to_mv(ads1118_thermocouple_type_t type, float deg, float *mv)
 {
-    if (handle == NULL)                                /* check handle */
+    if (type > ADS1118_THERMOCOUPLE_TYPE_N)                                               /* check type */
     {
-        return 2;                                      /* return error */
+        return 1;                                                                         /* return error */
     }
-    if (handle->inited != 1)                           /* check handle initialization */
+    if ((deg < gs_tc_fwd_min[type]) || (deg > gs_tc_fwd_max[type]))                       /* check deg */
     {
-        return 3;                                      /* return error */
+        return 4;                                                                         /* return error */
     }
     
-    if (handle->spi_transmit(tx, rx, len) != 0)        /* spi transmit */
+    *mv = a_ads1118_tc_deg_to_mv((uint8_t)type, deg);                                     /* convert */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      convert a thermocouple emf to the temperature
+ * @param[in]  type thermocouple type
+ * @param[in]  mv emf in mV
+ * @param[out] *deg pointer to a deg buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 type is invalid
+ *             - 4 mv is out of range
+ * @note       nist its-90 inverse polynomials, -200C to the max temperature of the type, -210C for the j type,
+ *             an out of range emf is clamped to the table limit
+ */
+uint8_t ads1118_thermocouple_mv_to_deg(ads1118_thermocouple_type_t type, float mv, float *deg)
+{
+    if (type > ADS1118_THERMOCOUPLE_TYPE_N)                                               /* check type */
+    {
+        return 1;                                                                         /* return error */
+    }
+    if (a_ads1118_tc_mv_to_deg((uint8_t)type, mv, deg) != 0)                              /* convert */
     {
-        return 1;                                      /* return error */
+        return 4;                                                                         /* return error */
     }
     
-    return 0;                                          /* success return 0 */
+    return 0;                                                                             /* success return 0 */
 }
 
 /**
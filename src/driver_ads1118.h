@@ -56,6 +56,55 @@ extern "C"{
  * @{
  */
 
+/**
+ * @brief ads1118 batch frame number definition
+ */
+#ifndef ADS1118_BATCH_MAX
+    #define ADS1118_BATCH_MAX        8        /**< max queued frames in the batch mode */
+#endif
+
+/**
+ * @brief ads1118 hot path counters definition
+ */
+#ifndef ADS1118_STATS_ENABLE
+    #define ADS1118_STATS_ENABLE     0        /**< 1 to compile the counters into the handle */
+#endif
+
+/**
+ * @brief ads1118 spi trace definition
+ */
+#ifndef ADS1118_TRACE_ENABLE
+    #define ADS1118_TRACE_ENABLE     0        /**< 1 to compile the trace ring into the handle */
+#endif
+#ifndef ADS1118_TRACE_DEPTH
+    #define ADS1118_TRACE_DEPTH      64       /**< trace entries, must be a power of 2 */
+#endif
+#if ((ADS1118_TRACE_DEPTH) <= 0) || (((ADS1118_TRACE_DEPTH) & ((ADS1118_TRACE_DEPTH) - 1)) != 0)
+    #error "ADS1118_TRACE_DEPTH must be a power of 2"
+#endif
+
+/**
+ * @brief ads1118 filter definition
+ */
+#ifndef ADS1118_FILTER_ORDER_MAX
+    #define ADS1118_FILTER_ORDER_MAX 4        /**< max cic order */
+#endif
+#ifndef ADS1118_FILTER_FRAC_BITS
+    #define ADS1118_FILTER_FRAC_BITS 8        /**< fraction bits of the filter output */
+#endif
+
+/**
+ * @brief ads1118 auto range definition
+ * @note  2 * ADS1118_AUTORANGE_LOW must be under ADS1118_AUTORANGE_HIGH,
+ *        so a result never goes back after a range step
+ */
+#ifndef ADS1118_AUTORANGE_HIGH
+    #define ADS1118_AUTORANGE_HIGH   30000    /**< code to go to the larger range */
+#endif
+#ifndef ADS1118_AUTORANGE_LOW
+    #define ADS1118_AUTORANGE_LOW    12000    /**< code to go to the smaller range */
+#endif
+
 /**
  * @brief ads1118 bool enumeration definition
  */
@@ -117,6 +166,129 @@ typedef enum
     ADS1118_MODE_TEMPERATURE = 0x01,        /**< temperature mode */
 } ads1118_mode_t;
 
+/**
+ * @brief ads1118 continuous status enumeration definition
+ */
+typedef enum
+{
+    ADS1118_CONTINUOUS_STATUS_FRESH     = 0x00,        /**< one new conversion since the last read */
+    ADS1118_CONTINUOUS_STATUS_DUPLICATE = 0x01,        /**< no new conversion, the last result is read again */
+    ADS1118_CONTINUOUS_STATUS_SKIPPED   = 0x02,        /**< new conversion with missed conversions before it */
+} ads1118_continuous_status_t;
+
+/**
+ * @brief ads1118 slot structure definition
+ */
+typedef struct ads1118_slot_s
+{
+    ads1118_channel_t channel;        /**< adc channel */
+    ads1118_range_t range;            /**< adc range */
+    ads1118_rate_t rate;              /**< adc rate */
+    ads1118_mode_t mode;              /**< chip mode */
+} ads1118_slot_t;
+
+/**
+ * @brief ads1118 frame structure definition
+ */
+typedef struct ads1118_frame_s
+{
+    uint8_t *tx;        /**< tx buffer */
+    uint8_t *rx;        /**< rx buffer */
+    uint16_t len;       /**< frame length */
+} ads1118_frame_t;
+
+/**
+ * @brief ads1118 api enumeration definition
+ */
+typedef enum
+{
+    ADS1118_API_INIT                  = 0x00,        /**< ads1118_init */
+    ADS1118_API_DEINIT                = 0x01,        /**< ads1118_deinit */
+    ADS1118_API_SET_CHANNEL           = 0x02,        /**< ads1118_set_channel */
+    ADS1118_API_SET_RANGE             = 0x03,        /**< ads1118_set_range */
+    ADS1118_API_SET_RATE              = 0x04,        /**< ads1118_set_rate */
+    ADS1118_API_SET_MODE              = 0x05,        /**< ads1118_set_mode */
+    ADS1118_API_SET_DOUT_PULL_UP      = 0x06,        /**< ads1118_set_dout_pull_up */
+    ADS1118_API_SYNC_CONFIG           = 0x07,        /**< ads1118_sync_config */
+    ADS1118_API_VERIFY_CONFIG         = 0x08,        /**< ads1118_verify_config */
+    ADS1118_API_BATCH_END             = 0x09,        /**< ads1118_batch_end */
+    ADS1118_API_SINGLE_READ           = 0x0A,        /**< ads1118_single_read */
+    ADS1118_API_CONVERT_AND_FETCH     = 0x0B,        /**< ads1118_convert_and_fetch */
+    ADS1118_API_SCAN                  = 0x0C,        /**< ads1118_scan */
+    ADS1118_API_CONTINUOUS_READ       = 0x0D,        /**< ads1118_continuous_read and ads1118_continuous_read_block */
+    ADS1118_API_START_CONTINUOUS_READ = 0x0E,        /**< ads1118_start_continuous_read */
+    ADS1118_API_STOP_CONTINUOUS_READ  = 0x0F,        /**< ads1118_stop_continuous_read */
+    ADS1118_API_TRANSMIT              = 0x10,        /**< ads1118_transmit */
+    ADS1118_API_SINGLE_ASYNC          = 0x11,        /**< ads1118_single_start, ads1118_single_is_ready and ads1118_single_fetch */
+    ADS1118_API_CAPTURE_OFFSET        = 0x12,        /**< ads1118_capture_offset */
+    ADS1118_API_THERMOCOUPLE_READ     = 0x13,        /**< ads1118_thermocouple_read */
+    ADS1118_API_MAX                   = 0x14,        /**< api number */
+} ads1118_api_t;
+
+/**
+ * @brief ads1118 stats structure definition
+ */
+typedef struct ads1118_stats_s
+{
+    uint32_t transfers;                     /**< spi frames */
+    uint32_t bytes;                         /**< spi bytes */
+    uint32_t transfer_errors;               /**< failed spi frames */
+    uint32_t drdy_reads;                    /**< dout/drdy reads */
+    uint64_t delay_us;                      /**< requested delay time in us */
+    uint32_t config_reads;                  /**< config register reads */
+    uint32_t config_writes;                 /**< config register writes */
+    uint32_t samples;                       /**< delivered samples */
+    uint32_t error[ADS1118_API_MAX];        /**< bus, drdy and timeout errors of every api */
+} ads1118_stats_t;
+
+/**
+ * @brief ads1118 continuous count structure definition
+ */
+typedef struct ads1118_continuous_count_s
+{
+    uint32_t fresh;            /**< results of new conversions */
+    uint32_t duplicate;        /**< results read again */
+    uint32_t skipped;          /**< missed conversions */
+} ads1118_continuous_count_t;
+
+/**
+ * @brief ads1118 calibration structure definition
+ */
+typedef struct ads1118_calibration_s
+{
+    int16_t offset;        /**< offset code */
+    uint16_t gain;         /**< gain in q15, 32768 is 1.0 */
+} ads1118_calibration_t;
+
+/**
+ * @brief ads1118 trace type enumeration definition
+ */
+typedef enum
+{
+    ADS1118_TRACE_TYPE_READ_CONFIG = 0x00,        /**< config read frame */
+    ADS1118_TRACE_TYPE_READ_DATA   = 0x01,        /**< data read frame */
+    ADS1118_TRACE_TYPE_WRITE       = 0x02,        /**< config write frame */
+    ADS1118_TRACE_TYPE_WRITE_READ  = 0x03,        /**< config write and data read frame */
+    ADS1118_TRACE_TYPE_TRANSMIT    = 0x04,        /**< ads1118_transmit frame */
+    ADS1118_TRACE_TYPE_BATCH       = 0x05,        /**< queued frames */
+} ads1118_trace_type_t;
+
+/**
+ * @brief ads1118 trace structure definition
+ */
+typedef struct ads1118_trace_s
+{
+    uint64_t timestamp;        /**< start time in us */
+    uint32_t duration;         /**< transmit time in us */
+    uint32_t seq;              /**< sequence number */
+    uint16_t len;              /**< frame length, total bytes of a batch */
+    uint8_t type;              /**< trace type, one of ads1118_trace_type_t */
+    uint8_t api;               /**< running api, one of ads1118_api_t */
+    uint8_t res;               /**< transmit return code */
+    uint8_t tx[4];             /**< first tx bytes */
+    uint8_t rx[4];             /**< first rx bytes */
+} ads1118_trace_t;
+
 /**
  * @brief ads1118 handle structure definition
  */
@@ -125,11 +297,163 @@ typedef struct ads1118_handle_s
     uint8_t (*spi_init)(void);                                              /**< point to a spi_init function address */
     uint8_t (*spi_deinit)(void);                                            /**< point to a spi_deinit function address */
     uint8_t (*spi_transmit)(uint8_t *tx, uint8_t *rx, uint16_t len);        /**< point to a spi_transmit function address */
+    uint8_t (*spi_transmit_batch)(ads1118_frame_t *frame, uint16_t num);    /**< point to a spi_transmit_batch function address */
     void (*delay_ms)(uint32_t ms);                                          /**< point to a delay_ms function address */
+    void (*delay_us)(uint32_t us);                                          /**< point to a delay_us function address */
+    uint8_t (*drdy_read)(uint8_t *level);                                   /**< point to a drdy_read function address */
+    uint64_t (*get_time_us)(void);                                          /**< point to a get_time_us function address */
     void (*debug_print)(const char *const fmt, ...);                        /**< point to a debug_print function address */
+    uint8_t (*spi_init_ctx)(void *user);                                    /**< point to a spi_init_ctx function address */
+    uint8_t (*spi_deinit_ctx)(void *user);                                  /**< point to a spi_deinit_ctx function address */
+    uint8_t (*spi_transmit_ctx)(void *user, uint8_t *tx,
+                                uint8_t *rx, uint16_t len);                 /**< point to a spi_transmit_ctx function address */
+    uint8_t (*drdy_read_ctx)(void *user, uint8_t *level);                   /**< point to a drdy_read_ctx function address */
+    void *user;                                                             /**< user context of the ctx functions */
+    uint16_t conf;                                                          /**< config register shadow */
+    ads1118_frame_t batch[ADS1118_BATCH_MAX];                               /**< queued frames */
+    uint8_t batch_buf[ADS1118_BATCH_MAX][4];                                /**< queued config write buffer */
+    uint8_t batch_len;                                                      /**< queued frame number */
+    uint8_t batch_enable;                                                   /**< batch mode flag */
+    uint8_t chip_mode;                                                      /**< mode bit of the config the chip holds */
+    uint64_t single_deadline;                                               /**< ready time of the started single conversion */
+    uint8_t single_busy;                                                    /**< single conversion started flag */
+    uint8_t fetch_pending;                                                  /**< convert and fetch conversion started flag */
+    uint64_t data_time;                                                     /**< get_time_us time of the last data read */
+    uint64_t cont_start;                                                    /**< get_time_us time of the continuous mode start */
+    uint64_t cont_index;                                                    /**< conversion index of the last continuous result */
+    ads1118_continuous_count_t cont_count;                                  /**< cumulative continuous counts */
+    uint32_t cont_skipped;                                                  /**< missed conversions before the last result */
+    uint8_t cont_status;                                                    /**< status of the last continuous result */
+    uint8_t autorange_enable;                                               /**< auto range flag */
+    uint8_t autorange[8];                                                   /**< best range of every channel */
+    ads1118_calibration_t calibration[8][6];                                /**< calibration of every channel and range */
+    uint8_t calibration_enable;                                             /**< calibration flag */
+#if (ADS1118_STATS_ENABLE != 0)
+    ads1118_stats_t stats;                                                  /**< hot path counters */
+#endif
+#if (ADS1118_TRACE_ENABLE != 0)
+    ads1118_trace_t trace[ADS1118_TRACE_DEPTH];                             /**< trace ring */
+    uint32_t trace_seq;                                                     /**< next trace sequence number */
+    uint8_t trace_enable;                                                   /**< trace flag */
+#endif
+#if (ADS1118_STATS_ENABLE != 0) || (ADS1118_TRACE_ENABLE != 0)
+    uint8_t api;                                                            /**< running api */
+#endif
     uint8_t inited;                                                         /**< inited flag */
 } ads1118_handle_t;
 
+/**
+ * @brief ads1118 sample structure definition
+ */
+typedef struct ads1118_sample_s
+{
+    uint64_t timestamp;        /**< timestamp in us */
+    int16_t raw;               /**< raw adc data */
+    uint8_t channel;           /**< adc channel, one of ads1118_channel_t */
+    uint8_t range;             /**< adc range, one of ads1118_range_t */
+    uint8_t rate;              /**< adc rate, one of ads1118_rate_t */
+    uint8_t device;            /**< device index on the bus */
+    uint8_t status;            /**< continuous status, one of ads1118_continuous_status_t */
+    uint8_t skipped;           /**< missed conversions before this one, saturated at 255 */
+} ads1118_sample_t;
+
+/**
+ * @brief ads1118 ring structure definition
+ */
+typedef struct ads1118_ring_s
+{
+    ads1118_sample_t *buf;            /**< sample buffer */
+    uint32_t size;                    /**< buffer size */
+    volatile uint32_t head;           /**< write counter, only changed by the producer */
+    volatile uint32_t tail;           /**< read counter, only changed by the consumer */
+    volatile uint32_t overrun;        /**< dropped sample counter, only changed by the producer */
+} ads1118_ring_t;
+
+/**
+ * @brief ads1118 bus device structure definition
+ */
+typedef struct ads1118_bus_device_s
+{
+    ads1118_handle_t *handle;          /**< initialized ads1118 handle */
+    const ads1118_slot_t *slot;        /**< slot list converted round robin */
+    uint8_t slot_len;                  /**< slot list length */
+    uint8_t cursor;                    /**< next slot index */
+    uint8_t pending;                   /**< pending slot index + 1, 0 means none */
+    uint64_t deadline;                 /**< ready time of the pending slot in us, the first drdy poll with drdy */
+} ads1118_bus_device_t;
+
+/**
+ * @brief ads1118 bus structure definition
+ */
+typedef struct ads1118_bus_s
+{
+    ads1118_bus_device_t *device;        /**< device list */
+    uint8_t num;                         /**< device number */
+    void (*lock)(void);                  /**< point to a lock function address */
+    void (*unlock)(void);                /**< point to an unlock function address */
+    uint8_t inited;                      /**< inited flag */
+} ads1118_bus_t;
+
+/**
+ * @brief ads1118 filter type enumeration definition
+ */
+typedef enum
+{
+    ADS1118_FILTER_TYPE_BOXCAR = 0x00,        /**< mean of every ratio samples */
+    ADS1118_FILTER_TYPE_CIC    = 0x01,        /**< cascaded integrator comb */
+    ADS1118_FILTER_TYPE_FIR    = 0x02,        /**< fir with q15 coefficients */
+} ads1118_filter_type_t;
+
+/**
+ * @brief ads1118 filter structure definition
+ */
+typedef struct ads1118_filter_s
+{
+    ads1118_filter_type_t type;                          /**< filter type */
+    uint16_t ratio;                                      /**< decimation ratio */
+    uint16_t phase;                                      /**< input samples since the last output */
+    uint8_t order;                                       /**< cic order */
+    int32_t acc;                                         /**< boxcar accumulator */
+    uint64_t integrator[ADS1118_FILTER_ORDER_MAX];       /**< cic integrators, modulo 2^64 */
+    uint64_t comb[ADS1118_FILTER_ORDER_MAX];             /**< cic comb delays */
+    uint64_t gain;                                       /**< dc gain of the sum */
+    const int16_t *coef;                                 /**< fir q15 coefficients */
+    int16_t *history;                                    /**< fir delay line */
+    uint16_t taps;                                       /**< fir tap number */
+    uint16_t pos;                                        /**< fir delay line position */
+    uint8_t inited;                                      /**< inited flag */
+} ads1118_filter_t;
+
+/**
+ * @brief ads1118 thermocouple type enumeration definition
+ */
+typedef enum
+{
+    ADS1118_THERMOCOUPLE_TYPE_K = 0x00,        /**< nickel-chromium / nickel-aluminum */
+    ADS1118_THERMOCOUPLE_TYPE_J = 0x01,        /**< iron / copper-nickel */
+    ADS1118_THERMOCOUPLE_TYPE_T = 0x02,        /**< copper / copper-nickel */
+    ADS1118_THERMOCOUPLE_TYPE_E = 0x03,        /**< nickel-chromium / copper-nickel */
+    ADS1118_THERMOCOUPLE_TYPE_N = 0x04,        /**< nickel-chromium-silicon / nickel-silicon */
+} ads1118_thermocouple_type_t;
+
+/**
+ * @brief ads1118 thermocouple structure definition
+ */
+typedef struct ads1118_thermocouple_s
+{
+    ads1118_thermocouple_type_t type;        /**< thermocouple type */
+    ads1118_channel_t channel;               /**< differential channel of the thermocouple */
+    ads1118_range_t range;                   /**< adc range */
+    ads1118_rate_t rate;                     /**< adc rate of both conversions */
+    uint16_t ratio;                          /**< thermocouple conversions per cold junction conversion */
+    uint16_t count;                          /**< thermocouple conversions since the cold junction conversion */
+    float cj_deg;                            /**< cached cold junction temperature */
+    float cj_mv;                             /**< emf of the cached cold junction temperature in mV */
+    int32_t cj_code;                         /**< emf of the cached cold junction temperature in 1/2048 mV */
+    uint8_t cj_valid;                        /**< cold junction cache flag */
+    uint8_t inited;                          /**< inited flag */
+} ads1118_thermocouple_t;
+
 /**
  * @brief ads1118 information structure definition
  */
@@ -189,6 +513,15 @@ typedef struct ads1118_info_s
  */
 #define DRIVER_ADS1118_LINK_SPI_TRANSMIT(HANDLE, FUC)           (HANDLE)->spi_transmit = FUC
 
+/**
+ * @brief     link spi_transmit_batch function
+ * @param[in] HANDLE pointer to an ads1118 handle structure
+ * @param[in] FUC pointer to an spi_transmit_batch function address
+ * @note      optional, the function sends all frames in one bus transaction with cs released between frames,
+ *            the batch mode falls back to one spi_transmit per frame if it is not linked
+ */
+#define DRIVER_ADS1118_LINK_SPI_TRANSMIT_BATCH(HANDLE, FUC)     (HANDLE)->spi_transmit_batch = FUC
+
 /**
  * @brief     link delay_ms function
  * @param[in] HANDLE pointer to an ads1118 handle structure
@@ -197,6 +530,31 @@ typedef struct ads1118_info_s
  */
 #define DRIVER_ADS1118_LINK_DELAY_MS(HANDLE, FUC)               (HANDLE)->delay_ms = FUC
 
+/**
+ * @brief     link delay_us function
+ * @param[in] HANDLE pointer to an ads1118 handle structure
+ * @param[in] FUC pointer to a delay_us function address
+ * @note      optional, the conversion wait uses the delay_ms table if it is not linked
+ */
+#define DRIVER_ADS1118_LINK_DELAY_US(HANDLE, FUC)               (HANDLE)->delay_us = FUC
+
+/**
+ * @brief     link drdy_read function
+ * @param[in] HANDLE pointer to an ads1118 handle structure
+ * @param[in] FUC pointer to a drdy_read function address
+ * @note      optional, the function reads the dout/drdy level with cs low and returns 0 on success,
+ *            level 0 means the conversion is done
+ */
+#define DRIVER_ADS1118_LINK_DRDY_READ(HANDLE, FUC)              (HANDLE)->drdy_read = FUC
+
+/**
+ * @brief     link get_time_us function
+ * @param[in] HANDLE pointer to an ads1118 handle structure
+ * @param[in] FUC pointer to a get_time_us function address
+ * @note      optional, the function returns a monotonic time in us
+ */
+#define DRIVER_ADS1118_LINK_GET_TIME_US(HANDLE, FUC)            (HANDLE)->get_time_us = FUC
+
 /**
  * @brief     link debug_print function
  * @param[in] HANDLE pointer to an ads1118 handle structure
@@ -205,6 +563,47 @@ typedef struct ads1118_info_s
  */
 #define DRIVER_ADS1118_LINK_DEBUG_PRINT(HANDLE, FUC)            (HANDLE)->debug_print = FUC
 
+/**
+ * @brief     link the user context
+ * @param[in] HANDLE pointer to an ads1118 handle structure
+ * @param[in] USER pointer to a user context
+ * @note      the context is passed to the ctx functions, so one set of functions can serve several chips
+ */
+#define DRIVER_ADS1118_LINK_USER(HANDLE, USER)                  (HANDLE)->user = (void *)(USER)
+
+/**
+ * @brief     link spi_init_ctx function
+ * @param[in] HANDLE pointer to an ads1118 handle structure
+ * @param[in] FUC pointer to a spi_init_ctx function address
+ * @note      optional, it is used instead of spi_init if it is linked
+ */
+#define DRIVER_ADS1118_LINK_SPI_INIT_CTX(HANDLE, FUC)           (HANDLE)->spi_init_ctx = FUC
+
+/**
+ * @brief     link spi_deinit_ctx function
+ * @param[in] HANDLE pointer to an ads1118 handle structure
+ * @param[in] FUC pointer to a spi_deinit_ctx function address
+ * @note      optional, it is used instead of spi_deinit if it is linked
+ */
+#define DRIVER_ADS1118_LINK_SPI_DEINIT_CTX(HANDLE, FUC)         (HANDLE)->spi_deinit_ctx = FUC
+
+/**
+ * @brief     link spi_transmit_ctx function
+ * @param[in] HANDLE pointer to an ads1118 handle structure
+ * @param[in] FUC pointer to a spi_transmit_ctx function address
+ * @note      optional, it is used instead of spi_transmit if it is linked,
+ *            spi_transmit_batch is not used then and the queued frames are sent one by one
+ */
+#define DRIVER_ADS1118_LINK_SPI_TRANSMIT_CTX(HANDLE, FUC)       (HANDLE)->spi_transmit_ctx = FUC
+
+/**
+ * @brief     link drdy_read_ctx function
+ * @param[in] HANDLE pointer to an ads1118 handle structure
+ * @param[in] FUC pointer to a drdy_read_ctx function address
+ * @note      optional, it is used instead of drdy_read if it is linked
+ */
+#define DRIVER_ADS1118_LINK_DRDY_READ_CTX(HANDLE, FUC)          (HANDLE)->drdy_read_ctx = FUC
+
 /**
  * @}
  */
@@ -234,6 +633,7 @@ uint8_t ads1118_info(ads1118_info_t *info);
  *            - 1 spi initialization failed
  *            - 2 handle is NULL
  *            - 3 linked functions is NULL
+ *            - 4 read config failed
  * @note      none
  */
 uint8_t ads1118_init(ads1118_handle_t *handle);
@@ -261,10 +661,132 @@ uint8_t ads1118_deinit(ads1118_handle_t *handle);
  *             - 1 single read failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       v can be NULL to skip the float conversion
  */
 uint8_t ads1118_single_read(ads1118_handle_t *handle, int16_t *raw, float *v);
 
+/**
+ * @brief      read a timestamped sample from the chip once
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *sample pointer to a sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the timestamp is the get_time_us time of the data read frame,
+ *             so it is the end of the conversion within the drdy poll or delay step,
+ *             the timestamp is 0 if get_time_us is not linked
+ */
+uint8_t ads1118_single_read_sample(ads1118_handle_t *handle, ads1118_sample_t *sample);
+
+/**
+ * @brief      start a single conversion without waiting
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *ready_us pointer to a ready time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single start failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       ready_us is the get_time_us time when the result is ready with the conversion time + 10%,
+ *             it is the time from now if get_time_us is not linked,
+ *             do not change the config before ads1118_single_fetch
+ */
+uint8_t ads1118_single_start(ads1118_handle_t *handle, uint64_t *ready_us);
+
+/**
+ * @brief      check whether the started single conversion is finished
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *ready pointer to a ready buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single is ready failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 no conversion is started
+ *             - 5 neither drdy nor get_time_us is linked
+ * @note       it never waits, dout/drdy is read if drdy is linked,
+ *             otherwise the ready time of ads1118_single_start is compared with get_time_us,
+ *             a drdy which stays high past the ready time + margin is a conversion timeout,
+ *             which drops the conversion so ads1118_single_fetch returns 4
+ */
+uint8_t ads1118_single_is_ready(ads1118_handle_t *handle, ads1118_bool_t *ready);
+
+/**
+ * @brief      fetch the result of the started single conversion
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *raw pointer to a raw adc buffer
+ * @param[out] *v pointer to a converted adc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single fetch failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 no conversion is started
+ * @note       call it after ads1118_single_is_ready returns true,
+ *             v can be NULL to skip the float conversion
+ */
+uint8_t ads1118_single_fetch(ads1118_handle_t *handle, int16_t *raw, float *v);
+
+/**
+ * @brief      start a conversion and fetch the previous result in one transmission
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  *next pointer to the slot of the conversion to start
+ * @param[out] *prev_raw pointer to a raw adc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 convert and fetch failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the chip is set to the single shot mode and the slot config is kept in the config shadow,
+ *             prev_raw is the result of the conversion started by the last call,
+ *             prev_raw is corrected with the entry of its slot if the calibration is enabled,
+ *             the first call of a pipeline returns a stale result which is neither corrected nor counted as a sample,
+ *             any other frame between two calls starts a new pipeline,
+ *             wait the conversion time of the slot before the next call
+ */
+uint8_t ads1118_convert_and_fetch(ads1118_handle_t *handle, const ads1118_slot_t *next, int16_t *prev_raw);
+
+/**
+ * @brief      scan a list of slots
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  *slot pointer to a slot list
+ * @param[in]  len slot list length
+ * @param[out] *raw pointer to a raw adc buffer
+ * @param[out] *v pointer to a converted adc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 scan failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 len is invalid
+ * @note       each transmission starts the next slot while reading the last one,
+ *             so a scan of len slots takes len + 1 transmissions,
+ *             v is the voltage in the adc mode and the temperature in the temperature mode,
+ *             v can be NULL to skip the float conversion
+ */
+uint8_t ads1118_scan(ads1118_handle_t *handle, const ads1118_slot_t *slot, uint8_t len,
+                     int16_t *raw, float *v);
+
+/**
+ * @brief      scan a list of slots into timestamped samples
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  *slot pointer to a slot list
+ * @param[in]  len slot list length
+ * @param[out] *sample pointer to a sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 scan failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 len is invalid
+ * @note       the transmissions are the same as ads1118_scan,
+ *             every timestamp is the get_time_us time of the frame which fetched the slot result
+ */
+uint8_t ads1118_scan_sample(ads1118_handle_t *handle, const ads1118_slot_t *slot, uint8_t len,
+                            ads1118_sample_t *sample);
+
 /**
  * @brief      read data from the chip continuously
  * @param[in]  *handle pointer to an ads1118 handle structure
@@ -276,10 +798,65 @@ uint8_t ads1118_single_read(ads1118_handle_t *handle, int16_t *raw, float *v);
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       this function can be used only after run ads1118_start_continuous_read
- *             and can be stopped by ads1118_stop_continuous_read
+ *             and can be stopped by ads1118_stop_continuous_read,
+ *             v can be NULL to skip the float conversion
  */
 uint8_t ads1118_continuous_read(ads1118_handle_t *handle, int16_t *raw, float *v);
 
+/**
+ * @brief      read a block of data from the chip continuously
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *raw pointer to a raw adc buffer
+ * @param[out] *v pointer to a converted adc buffer
+ * @param[in]  len buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 continuous read block failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 len is invalid
+ * @note       this function can be used only after run ads1118_start_continuous_read,
+ *             the samples are paced by dout/drdy or the data period and converted after the last one,
+ *             v can be NULL to skip the float conversion
+ */
+uint8_t ads1118_continuous_read_block(ads1118_handle_t *handle, int16_t *raw, float *v, uint16_t len);
+
+/**
+ * @brief      read timestamped samples from the chip continuously
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *sample pointer to a sample buffer
+ * @param[in]  len buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 continuous read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 len is invalid
+ * @note       this function can be used only after run ads1118_start_continuous_read,
+ *             the first sample is read at once and the others are paced by dout/drdy or the data period,
+ *             every timestamp is the get_time_us time of its data read frame
+ */
+uint8_t ads1118_continuous_read_sample(ads1118_handle_t *handle, ads1118_sample_t *sample, uint16_t len);
+
+/**
+ * @brief      read decimated data from the chip continuously
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  *filter pointer to an ads1118 filter structure
+ * @param[out] *out pointer to a filter output buffer
+ * @param[in]  len buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 continuous read filter failed
+ *             - 2 handle or filter is NULL
+ *             - 3 handle or filter is not initialized
+ *             - 4 len is invalid
+ * @note       this function can be used only after run ads1118_start_continuous_read,
+ *             len * ratio conversions are read in blocks of 32 and paced by dout/drdy or the data period,
+ *             a result is only read once dout/drdy or the cadence says it is new,
+ *             duplicate results are dropped, the filter state is kept between the calls
+ */
+uint8_t ads1118_continuous_read_filter(ads1118_handle_t *handle, ads1118_filter_t *filter, int32_t *out, uint16_t len);
+
 /**
  * @brief     start the chip reading
  * @param[in] *handle pointer to an ads1118 handle structure
@@ -305,70 +882,320 @@ uint8_t ads1118_start_continuous_read(ads1118_handle_t *handle);
 uint8_t ads1118_stop_continuous_read(ads1118_handle_t *handle);
 
 /**
- * @brief      temperature convert
+ * @brief      get the status of the last continuous result
  * @param[in]  *handle pointer to an ads1118 handle structure
- * @param[in]  raw adc raw data
- * @param[out] *deg pointer to a deg buffer
+ * @param[out] *status pointer to a continuous status buffer
+ * @param[out] *skipped pointer to a missed conversion number buffer
  * @return     status code
  *             - 0 success
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
- */
-uint8_t ads1118_temperature_convert(ads1118_handle_t *handle, int16_t raw, float *deg);
-
-/**
- * @brief     set the adc channel
- * @param[in] *handle pointer to an ads1118 handle structure
- * @param[in] channel adc channel
- * @return    status code
- *            - 0 success
- *            - 1 set channel failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @note       with drdy_read linked dout/drdy decides fresh or duplicate,
+ *             with get_time_us linked the conversion cadence from ads1118_start_continuous_read
+ *             at the configured rate counts the missed conversions and decides fresh or duplicate without drdy,
+ *             with neither of them linked every result is reported fresh
  */
-uint8_t ads1118_set_channel(ads1118_handle_t *handle, ads1118_channel_t channel);
+uint8_t ads1118_get_continuous_status(ads1118_handle_t *handle, ads1118_continuous_status_t *status, uint32_t *skipped);
 
 /**
- * @brief      get the adc channel
+ * @brief      get the cumulative continuous counts
  * @param[in]  *handle pointer to an ads1118 handle structure
- * @param[out] *channel pointer to a channel buffer
+ * @param[out] *count pointer to an ads1118 continuous count structure
  * @return     status code
  *             - 0 success
- *             - 1 get channel failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the counts are cleared by ads1118_init and ads1118_clear_continuous_count,
+ *             fresh / (fresh + skipped) is the share of the conversions delivered to the caller
  */
-uint8_t ads1118_get_channel(ads1118_handle_t *handle, ads1118_channel_t *channel);
+uint8_t ads1118_get_continuous_count(ads1118_handle_t *handle, ads1118_continuous_count_t *count);
 
 /**
- * @brief     set the adc range
+ * @brief     clear the cumulative continuous counts
  * @param[in] *handle pointer to an ads1118 handle structure
- * @param[in] range adc max voltage range
  * @return    status code
  *            - 0 success
- *            - 1 set range failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t ads1118_set_range(ads1118_handle_t *handle, ads1118_range_t range);
+uint8_t ads1118_clear_continuous_count(ads1118_handle_t *handle);
 
 /**
- * @brief      get the adc range
+ * @brief      temperature convert
  * @param[in]  *handle pointer to an ads1118 handle structure
- * @param[out] *range pointer to a voltage range buffer
+ * @param[in]  raw adc raw data
+ * @param[out] *deg pointer to a deg buffer
  * @return     status code
  *             - 0 success
- *             - 1 get range failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ads1118_temperature_convert(ads1118_handle_t *handle, int16_t raw, float *deg);
+
+/**
+ * @brief      convert the raw data to microvolts
+ * @param[in]  range adc range
+ * @param[in]  raw adc raw data
+ * @param[out] *uv pointer to a microvolt buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 range is invalid
+ * @note       integer only, the result is raw * fsr / 32768 rounded half away from zero
+ */
+uint8_t ads1118_raw_to_microvolts(ads1118_range_t range, int16_t raw, int32_t *uv);
+
+/**
+ * @brief      convert a raw data block to the voltage
+ * @param[in]  range adc range
+ * @param[in]  *raw pointer to a raw adc buffer
+ * @param[out] *v pointer to a converted adc buffer
+ * @param[in]  n buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 range is invalid
+ * @note       the result is the same as the read functions, sse2 or neon is used if the target has it
+ */
+uint8_t ads1118_raw_to_volts_n(ads1118_range_t range, const int16_t *raw, float *v, uint32_t n);
+
+/**
+ * @brief      convert a raw data block to the temperature
+ * @param[in]  *raw pointer to a raw adc buffer
+ * @param[out] *deg pointer to a deg buffer
+ * @param[in]  n buffer length
+ * @return     status code
+ *             - 0 success
+ * @note       the result is the same as ads1118_temperature_convert, sse2 or neon is used if the target has it
+ */
+uint8_t ads1118_raw_to_celsius_n(const int16_t *raw, float *deg, uint32_t n);
+
+/**
+ * @brief     enable or disable the calibration
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      with the calibration enabled single read, single fetch, scan, convert and fetch,
+ *            the bus service and all continuous reads correct the result with the entry of its channel and range,
+ *            raw gets the integer correction and v the float correction of the chip code,
+ *            the temperature mode is not corrected
+ */
+uint8_t ads1118_set_calibration(ads1118_handle_t *handle, ads1118_bool_t enable);
+
+/**
+ * @brief      get the calibration status
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ads1118_get_calibration(ads1118_handle_t *handle, ads1118_bool_t *enable);
+
+/**
+ * @brief     set the calibration of a channel and range
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] channel adc channel
+ * @param[in] range adc range
+ * @param[in] *cal pointer to an ads1118 calibration structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 range is invalid
+ * @note      the corrected code is (raw - offset) * gain / 32768,
+ *            ads1118_init sets every entry to offset 0 and gain 32768
+ */
+uint8_t ads1118_set_calibration_entry(ads1118_handle_t *handle, ads1118_channel_t channel, ads1118_range_t range,
+                                      const ads1118_calibration_t *cal);
+
+/**
+ * @brief      get the calibration of a channel and range
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  channel adc channel
+ * @param[in]  range adc range
+ * @param[out] *cal pointer to an ads1118 calibration structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is invalid
+ * @note       none
+ */
+uint8_t ads1118_get_calibration_entry(ads1118_handle_t *handle, ads1118_channel_t channel, ads1118_range_t range,
+                                      ads1118_calibration_t *cal);
+
+/**
+ * @brief      capture the offset of a channel and range
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  channel adc channel
+ * @param[in]  range adc range
+ * @param[in]  times averaged conversions
+ * @param[out] *offset pointer to an offset buffer, can be NULL
+ * @return     status code
+ *             - 0 success
+ *             - 1 capture offset failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is invalid
+ *             - 5 times is invalid
+ * @note       the chip mux has no internal short, so the inputs of the channel must be shorted on the board
+ *             or tied to gnd for a single ended channel while it runs,
+ *             the mean of times single shot conversions is saved as the offset of the entry,
+ *             the config is written back at the end, do not run it in the continuous mode
+ */
+uint8_t ads1118_capture_offset(ads1118_handle_t *handle, ads1118_channel_t channel, ads1118_range_t range,
+                               uint16_t times, int16_t *offset);
+
+/**
+ * @brief      correct a raw data block with the integer calibration
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  channel adc channel
+ * @param[in]  range adc range
+ * @param[in]  *raw pointer to a raw adc buffer
+ * @param[out] *out pointer to a corrected raw adc buffer
+ * @param[in]  n buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is invalid
+ * @note       raw and out can be the same buffer, the result is rounded half away from zero and saturated,
+ *             the entry is used even with the calibration disabled
+ */
+uint8_t ads1118_calibrate_n(ads1118_handle_t *handle, ads1118_channel_t channel, ads1118_range_t range,
+                            const int16_t *raw, int16_t *out, uint32_t n);
+
+/**
+ * @brief      convert a raw data block to the voltage with the float calibration
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  channel adc channel
+ * @param[in]  range adc range
+ * @param[in]  *raw pointer to a raw adc buffer
+ * @param[out] *v pointer to a converted adc buffer
+ * @param[in]  n buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is invalid
+ * @note       the result is (raw - offset) * gain / 32768 * fsr / 32768 without the integer rounding,
+ *             the entry is used even with the calibration disabled
+ */
+uint8_t ads1118_calibrate_to_volts_n(ads1118_handle_t *handle, ads1118_channel_t channel, ads1118_range_t range,
+                                     const int16_t *raw, float *v, uint32_t n);
+
+/**
+ * @brief     set the adc channel
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] channel adc channel
+ * @return    status code
+ *            - 0 success
+ *            - 1 set channel failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ads1118_set_channel(ads1118_handle_t *handle, ads1118_channel_t channel);
+
+/**
+ * @brief      get the adc channel
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *channel pointer to a channel buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get channel failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ads1118_get_channel(ads1118_handle_t *handle, ads1118_channel_t *channel);
+
+/**
+ * @brief     set the adc range
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] range adc max voltage range
+ * @return    status code
+ *            - 0 success
+ *            - 1 set range failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ads1118_set_range(ads1118_handle_t *handle, ads1118_range_t range);
+
+/**
+ * @brief      get the adc range
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *range pointer to a voltage range buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get range failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
 uint8_t ads1118_get_range(ads1118_handle_t *handle, ads1118_range_t *range);
 
+/**
+ * @brief     enable or disable the auto range
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      enabling starts every channel at the current range,
+ *            single read, single start, scan and continuous read pick the channel range
+ *            and step it after every result, the range change rides on the config write of the frame,
+ *            continuous read block, the filter read and the bus service keep the configured range
+ */
+uint8_t ads1118_set_autorange(ads1118_handle_t *handle, ads1118_bool_t enable);
+
+/**
+ * @brief      get the auto range status
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ads1118_get_autorange(ads1118_handle_t *handle, ads1118_bool_t *enable);
+
+/**
+ * @brief     set the auto range of a channel
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] channel adc channel
+ * @param[in] range adc max voltage range
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 range is invalid
+ * @note      use it to seed a channel with a known signal level
+ */
+uint8_t ads1118_set_autorange_range(ads1118_handle_t *handle, ads1118_channel_t channel, ads1118_range_t range);
+
+/**
+ * @brief      get the auto range of a channel
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  channel adc channel
+ * @param[out] *range pointer to a voltage range buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ads1118_get_autorange_range(ads1118_handle_t *handle, ads1118_channel_t channel, ads1118_range_t *range);
+
 /**
  * @brief     set the sample rate
  * @param[in] *handle pointer to an ads1118 handle structure
@@ -447,6 +1274,120 @@ uint8_t ads1118_set_dout_pull_up(ads1118_handle_t *handle, ads1118_bool_t enable
  */
 uint8_t ads1118_get_dout_pull_up(ads1118_handle_t *handle, ads1118_bool_t *enable);
 
+/**
+ * @brief     reload the config shadow from the chip
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 sync config failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the setters and getters work on the config shadow in the handle,
+ *            run this function if the chip config may be changed outside the driver
+ */
+uint8_t ads1118_sync_config(ads1118_handle_t *handle);
+
+/**
+ * @brief      verify the config shadow against the chip
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *match pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 verify config failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the config shadow is not changed, run ads1118_sync_config to reload it
+ */
+uint8_t ads1118_verify_config(ads1118_handle_t *handle, ads1118_bool_t *match);
+
+/**
+ * @brief     enter the batch mode
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      config writes and ads1118_transmit frames are queued until ads1118_batch_end,
+ *            any read, conversion start or mode change sends the queue first,
+ *            a queued config write directly before another one is replaced by it
+ */
+uint8_t ads1118_batch_begin(ads1118_handle_t *handle);
+
+/**
+ * @brief     send the queued frames and leave the batch mode
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 batch transmit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the rx buffers of the queued ads1118_transmit frames are valid after this function
+ */
+uint8_t ads1118_batch_end(ads1118_handle_t *handle);
+
+/**
+ * @brief      get the hot path counters
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[out] *stats pointer to an ads1118 stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 4 stats is disabled
+ * @note       the counters are only compiled in with ADS1118_STATS_ENABLE set to 1,
+ *             they are kept across ads1118_init and ads1118_deinit
+ */
+uint8_t ads1118_get_stats(ads1118_handle_t *handle, ads1118_stats_t *stats);
+
+/**
+ * @brief     clear the hot path counters
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 stats is disabled
+ * @note      none
+ */
+uint8_t ads1118_clear_stats(ads1118_handle_t *handle);
+
+/**
+ * @brief     enable or disable the spi trace
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 trace is disabled
+ * @note      the trace is only compiled in with ADS1118_TRACE_ENABLE set to 1,
+ *            enabling the trace clears the old entries
+ */
+uint8_t ads1118_set_trace(ads1118_handle_t *handle, ads1118_bool_t enable);
+
+/**
+ * @brief         get the spi trace
+ * @param[in]     *handle pointer to an ads1118 handle structure
+ * @param[out]    *entry pointer to a trace buffer
+ * @param[in,out] *len pointer to a length buffer
+ * @return        status code
+ *                - 0 success
+ *                - 2 handle is NULL
+ *                - 4 trace is disabled
+ * @note          len is the buffer size in and the copied entry number out,
+ *                the newest entries are copied from the oldest one to the newest one
+ */
+uint8_t ads1118_get_trace(ads1118_handle_t *handle, ads1118_trace_t *entry, uint32_t *len);
+
+/**
+ * @brief     print the spi trace
+ * @param[in] *handle pointer to an ads1118 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 trace is disabled
+ * @note      one "ads1118: trace" line is printed with debug_print for every entry from the oldest one,
+ *            the host decoder of the simulator project turns the lines into a timeline
+ */
+uint8_t ads1118_trace_dump(ads1118_handle_t *handle);
+
 /**
  * @}
  */
@@ -469,10 +1410,422 @@ uint8_t ads1118_get_dout_pull_up(ads1118_handle_t *handle, ads1118_bool_t *enabl
  *             - 1 transmit failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       in the batch mode the frame is queued and rx is valid after ads1118_batch_end
  */
 uint8_t ads1118_transmit(ads1118_handle_t *handle, uint8_t *tx, uint8_t *rx, uint16_t len);
 
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ads1118_bus_driver ads1118 bus driver function
+ * @brief    ads1118 bus driver modules
+ * @ingroup  ads1118_driver
+ * @{
+ */
+
+/**
+ * @brief     link bus lock function
+ * @param[in] BUS pointer to an ads1118 bus structure
+ * @param[in] FUC pointer to a lock function address
+ * @note      optional, the bus is locked while the frames of a round are sent
+ */
+#define DRIVER_ADS1118_BUS_LINK_LOCK(BUS, FUC)              (BUS)->lock = FUC
+
+/**
+ * @brief     link bus unlock function
+ * @param[in] BUS pointer to an ads1118 bus structure
+ * @param[in] FUC pointer to an unlock function address
+ * @note      optional
+ */
+#define DRIVER_ADS1118_BUS_LINK_UNLOCK(BUS, FUC)            (BUS)->unlock = FUC
+
+/**
+ * @brief     initialize the bus manager
+ * @param[in] *bus pointer to an ads1118 bus structure
+ * @param[in] *device pointer to a device list
+ * @param[in] num device number
+ * @return    status code
+ *            - 0 success
+ *            - 2 bus is NULL
+ *            - 4 num is invalid
+ *            - 5 device is invalid
+ * @note      every device needs an initialized handle and at least one slot,
+ *            the chips share one spi bus and every chip has its own cs
+ */
+uint8_t ads1118_bus_init(ads1118_bus_t *bus, ads1118_bus_device_t *device, uint8_t num);
+
+/**
+ * @brief     run one conversion round on all devices
+ * @param[in] *bus pointer to an ads1118 bus structure
+ * @param[in] *ring pointer to an ads1118 ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 round failed
+ *            - 2 bus is NULL
+ *            - 3 bus is not initialized
+ * @note      every device fetches the result of its last slot and starts its next slot in one frame,
+ *            so all chips convert at the same time and the round waits only once for the slowest slot,
+ *            the results of the last round are pushed into the ring with the device index,
+ *            every result is corrected with the calibration of its device handle,
+ *            ring can be NULL to drop the samples
+ */
+uint8_t ads1118_bus_round(ads1118_bus_t *bus, ads1118_ring_t *ring);
+
+/**
+ * @brief      service every device whose conversion is finished
+ * @param[in]  *bus pointer to an ads1118 bus structure
+ * @param[in]  *ring pointer to an ads1118 ring structure
+ * @param[out] *samples pointer to a sample number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 poll failed
+ *             - 2 bus is NULL
+ *             - 3 bus is not initialized
+ *             - 4 a device has neither drdy nor get_time_us linked
+ * @note       it never waits, an idle device or a finished device fetches its result and starts its next slot at once,
+ *             so the conversions stay staggered and every chip runs at its own rate,
+ *             a device is finished when dout/drdy is low if drdy is linked,
+ *             drdy is not read before the minimum conversion time if get_time_us is linked too,
+ *             otherwise when its deadline of conversion time + 10% is passed,
+ *             samples is the number of results pushed into the ring
+ */
+uint8_t ads1118_bus_poll(ads1118_bus_t *bus, ads1118_ring_t *ring, uint32_t *samples);
+
+/**
+ * @brief     run the interleaved scheduler until enough samples are collected
+ * @param[in] *bus pointer to an ads1118 bus structure
+ * @param[in] *ring pointer to an ads1118 ring structure
+ * @param[in] samples sample number
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 2 bus is NULL
+ *            - 3 bus is not initialized
+ *            - 4 a device has neither drdy nor get_time_us linked
+ * @note      the function polls the bus and sleeps until the next deadline or the next drdy poll between the polls,
+ *            the aggregate rate is close to the sum of the device rates while the bus has idle time,
+ *            exactly samples results are pushed and a finished device beyond them waits for the next call
+ */
+uint8_t ads1118_bus_run(ads1118_bus_t *bus, ads1118_ring_t *ring, uint32_t samples);
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ads1118_ring_driver ads1118 ring driver function
+ * @brief    ads1118 ring driver modules
+ * @ingroup  ads1118_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize the sample ring
+ * @param[in] *ring pointer to an ads1118 ring structure
+ * @param[in] *buf pointer to a sample buffer
+ * @param[in] size buffer size
+ * @return    status code
+ *            - 0 success
+ *            - 2 ring is NULL
+ *            - 4 size is invalid
+ * @note      size must be a power of 2,
+ *            the ring is lock free with one producer and one consumer
+ */
+uint8_t ads1118_ring_init(ads1118_ring_t *ring, ads1118_sample_t *buf, uint32_t size);
+
+/**
+ * @brief     push a sample into the ring
+ * @param[in] *ring pointer to an ads1118 ring structure
+ * @param[in] *sample pointer to a sample
+ * @return    status code
+ *            - 0 success
+ *            - 1 ring is full
+ *            - 2 ring is NULL
+ * @note      only call it from the producer, it can be used in the interrupt,
+ *            the sample is dropped and counted as an overrun if the ring is full
+ */
+uint8_t ads1118_ring_push(ads1118_ring_t *ring, const ads1118_sample_t *sample);
+
+/**
+ * @brief         pop samples from the ring
+ * @param[in]     *ring pointer to an ads1118 ring structure
+ * @param[out]    *sample pointer to a sample buffer
+ * @param[in,out] *len pointer to a length buffer
+ * @return        status code
+ *                - 0 success
+ *                - 2 ring is NULL
+ * @note          only call it from the consumer, it never blocks,
+ *                len is the buffer length in and the popped length out
+ */
+uint8_t ads1118_ring_pop(ads1118_ring_t *ring, ads1118_sample_t *sample, uint32_t *len);
+
+/**
+ * @brief      get the sample number in the ring
+ * @param[in]  *ring pointer to an ads1118 ring structure
+ * @param[out] *count pointer to a count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring is NULL
+ * @note       none
+ */
+uint8_t ads1118_ring_get_count(ads1118_ring_t *ring, uint32_t *count);
+
+/**
+ * @brief      get the dropped sample number
+ * @param[in]  *ring pointer to an ads1118 ring structure
+ * @param[out] *overrun pointer to an overrun buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring is NULL
+ * @note       the counter is never cleared, compare two readings to get the new drops
+ */
+uint8_t ads1118_ring_get_overrun(ads1118_ring_t *ring, uint32_t *overrun);
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ads1118_filter_driver ads1118 filter driver function
+ * @brief    ads1118 filter driver modules
+ * @ingroup  ads1118_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize a boxcar decimator
+ * @param[in] *filter pointer to an ads1118 filter structure
+ * @param[in] ratio decimation ratio
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ *            - 4 ratio is invalid
+ * @note      one output is the mean of ratio inputs
+ */
+uint8_t ads1118_filter_boxcar_init(ads1118_filter_t *filter, uint16_t ratio);
+
+/**
+ * @brief     initialize a cic decimator
+ * @param[in] *filter pointer to an ads1118 filter structure
+ * @param[in] ratio decimation ratio
+ * @param[in] order cic order from 1 to ADS1118_FILTER_ORDER_MAX
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ *            - 4 ratio or order is invalid
+ * @note      ratio ^ order must not be more than 2^32,
+ *            the dc gain is removed so the output has the scale of the input
+ */
+uint8_t ads1118_filter_cic_init(ads1118_filter_t *filter, uint16_t ratio, uint8_t order);
+
+/**
+ * @brief     initialize a fir decimator
+ * @param[in] *filter pointer to an ads1118 filter structure
+ * @param[in] ratio decimation ratio
+ * @param[in] *coef pointer to a q15 coefficient buffer
+ * @param[in] *history pointer to a delay line buffer
+ * @param[in] taps tap number
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ *            - 4 ratio or taps is invalid
+ * @note      history must hold 2 * taps samples and coef must live as long as the filter,
+ *            the coefficients sum to 32768 for a dc gain of 1,
+ *            only every ratio-th output is computed
+ */
+uint8_t ads1118_filter_fir_init(ads1118_filter_t *filter, uint16_t ratio, const int16_t *coef,
+                                 int16_t *history, uint16_t taps);
+
+/**
+ * @brief     reset the filter state
+ * @param[in] *filter pointer to an ads1118 filter structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ *            - 3 filter is not initialized
+ * @note      the type, ratio and coefficients are kept
+ */
+uint8_t ads1118_filter_reset(ads1118_filter_t *filter);
+
+/**
+ * @brief      run a block of raw data through the filter
+ * @param[in]  *filter pointer to an ads1118 filter structure
+ * @param[in]  *in pointer to a raw adc buffer
+ * @param[in]  len input length
+ * @param[out] *out pointer to a filter output buffer
+ * @param[out] *out_len pointer to an output length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 filter is NULL
+ *             - 3 filter is not initialized
+ * @note       out must hold len / ratio + 1 outputs,
+ *             an output is the raw code with ADS1118_FILTER_FRAC_BITS fraction bits,
+ *             the accumulation is integer only and rounded half away from zero at the output
+ */
+uint8_t ads1118_filter_process(ads1118_filter_t *filter, const int16_t *in, uint32_t len,
+                               int32_t *out, uint32_t *out_len);
+
+/**
+ * @brief      convert a filter output block to the voltage
+ * @param[in]  range adc range
+ * @param[in]  *in pointer to a filter output buffer
+ * @param[out] *v pointer to a converted adc buffer
+ * @param[in]  n buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 range is invalid
+ * @note       none
+ */
+uint8_t ads1118_filter_to_volts_n(ads1118_range_t range, const int32_t *in, float *v, uint32_t n);
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ads1118_thermocouple_driver ads1118 thermocouple driver function
+ * @brief    ads1118 thermocouple driver modules
+ * @ingroup  ads1118_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize a thermocouple pipeline
+ * @param[in] *tc pointer to an ads1118 thermocouple structure
+ * @param[in] type thermocouple type
+ * @param[in] channel differential channel of the thermocouple
+ * @param[in] range adc range
+ * @param[in] rate adc rate
+ * @param[in] ratio thermocouple conversions per cold junction conversion
+ * @return    status code
+ *            - 0 success
+ *            - 2 tc is NULL
+ *            - 4 type is invalid
+ *            - 5 range is invalid
+ *            - 6 ratio is invalid
+ * @note      the cold junction cache is empty, so the first read starts with a temperature sensor conversion,
+ *            0.256V covers every type up to its max temperature with the cold junction at 0C
+ */
+uint8_t ads1118_thermocouple_init(ads1118_thermocouple_t *tc, ads1118_thermocouple_type_t type,
+                                  ads1118_channel_t channel, ads1118_range_t range,
+                                  ads1118_rate_t rate, uint16_t ratio);
+
+/**
+ * @brief     set the cold junction temperature
+ * @param[in] *tc pointer to an ads1118 thermocouple structure
+ * @param[in] deg cold junction temperature
+ * @return    status code
+ *            - 0 success
+ *            - 2 tc is NULL
+ *            - 3 tc is not initialized
+ *            - 4 deg is out of range
+ * @note      the value is cached as a fresh temperature sensor result,
+ *            so the next ratio thermocouple conversions use it
+ */
+uint8_t ads1118_thermocouple_set_cold_junction(ads1118_thermocouple_t *tc, float deg);
+
+/**
+ * @brief      get the cached cold junction temperature
+ * @param[in]  *tc pointer to an ads1118 thermocouple structure
+ * @param[out] *deg pointer to a deg buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 tc is NULL
+ *             - 3 tc is not initialized
+ *             - 4 no cold junction temperature is cached
+ * @note       none
+ */
+uint8_t ads1118_thermocouple_get_cold_junction(ads1118_thermocouple_t *tc, float *deg);
+
+/**
+ * @brief      read a block of compensated thermocouple temperatures
+ * @param[in]  *handle pointer to an ads1118 handle structure
+ * @param[in]  *tc pointer to an ads1118 thermocouple structure
+ * @param[out] *deg pointer to a deg buffer
+ * @param[in]  len buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 thermocouple read failed
+ *             - 2 handle or tc is NULL
+ *             - 3 handle or tc is not initialized
+ *             - 4 len is invalid
+ *             - 5 a temperature is out of range
+ * @note       the chip runs single shot conversions like ads1118_scan, every frame starts the next conversion
+ *             and reads the last one, so the mode switch costs no extra frame,
+ *             one temperature sensor conversion is put in front of every ratio thermocouple conversions,
+ *             each thermocouple result is converted with the cached cold junction during the next conversion,
+ *             an out of range result is clamped to the table limit and the block is still read to the end,
+ *             the config shadow keeps the thermocouple slot at the end
+ */
+uint8_t ads1118_thermocouple_read(ads1118_handle_t *handle, ads1118_thermocouple_t *tc, float *deg, uint16_t len);
+
+/**
+ * @brief      convert a microvolt block to compensated temperatures
+ * @param[in]  *tc pointer to an ads1118 thermocouple structure
+ * @param[in]  *uv pointer to a thermocouple microvolt buffer
+ * @param[out] *deg pointer to a deg buffer
+ * @param[in]  n buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 2 tc is NULL
+ *             - 3 tc is not initialized
+ *             - 4 no cold junction temperature is cached
+ *             - 5 a temperature is out of range
+ * @note       uv can come from ads1118_raw_to_microvolts of a continuous block,
+ *             every sample uses the cached cold junction
+ */
+uint8_t ads1118_thermocouple_convert_n(ads1118_thermocouple_t *tc, const int32_t *uv, float *deg, uint32_t n);
+
+/**
+ * @brief      convert a raw block to compensated temperatures with the lookup table
+ * @param[in]  *tc pointer to an ads1118 thermocouple structure
+ * @param[in]  *raw pointer to a thermocouple raw buffer
+ * @param[out] *mdeg pointer to a temperature buffer in 0.001C
+ * @param[in]  n buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 2 tc is NULL
+ *             - 3 tc is not initialized
+ *             - 4 no cold junction temperature is cached
+ *             - 5 a temperature is out of range
+ * @note       raw is read with the range of tc, the code is scaled to 1/2048 mV, the cold junction emf is added
+ *             and the temperature is interpolated between nist points of 0.125mV with integer math only,
+ *             the table error is below 0.25C over the range of ads1118_thermocouple_mv_to_deg,
+ *             an out of range temperature is clamped to the table limit,
+ *             correct raw with ads1118_calibrate_n before if the calibration is used
+ */
+uint8_t ads1118_thermocouple_raw_to_mdeg_n(ads1118_thermocouple_t *tc, const int16_t *raw, int32_t *mdeg, uint32_t n);
+
+/**
+ * @brief      convert a temperature to the thermocouple emf
+ * @param[in]  type thermocouple type
+ * @param[in]  deg temperature
+ * @param[out] *mv pointer to an emf buffer in mV
+ * @return     status code
+ *             - 0 success
+ *             - 1 type is invalid
+ *             - 4 deg is out of range
+ * @note       nist its-90 reference polynomials, the k type has the exponential term above 0C,
+ *             the range is -270C to the max temperature of the type, -210C for the j type
+ */
+uint8_t ads1118_thermocouple_deg_to_mv(ads1118_thermocouple_type_t type, float deg, float *mv);
+
+/**
+ * @brief      convert a thermocouple emf to the temperature
+ * @param[in]  type thermocouple type
+ * @param[in]  mv emf in mV
+ * @param[out] *deg pointer to a deg buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 type is invalid
+ *             - 4 mv is out of range
+ * @note       nist its-90 inverse polynomials, -200C to the max temperature of the type, -210C for the j type,
+ *             an out of range emf is clamped to the table limit
+ */
+uint8_t ads1118_thermocouple_mv_to_deg(ads1118_thermocouple_type_t type, float mv, float *deg);
+
 /**
  * @}
  */
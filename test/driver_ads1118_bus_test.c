@@ -0,0 +1,290 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1118_bus_test.c
+ * @brief     driver ads1118 bus test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2024-02-28
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2024/02/28  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1118_bus_test.h"
+
+static ads1118_handle_t gs_handle[ADS1118_BUS_TEST_MAX];        /**< ads1118 handles */
+static ads1118_bus_device_t gs_device[ADS1118_BUS_TEST_MAX];    /**< bus devices */
+static ads1118_bus_t gs_bus;                                    /**< ads1118 bus */
+static ads1118_sample_t gs_buf[64];                             /**< sample buffer */
+static ads1118_ring_t gs_ring;                                  /**< sample ring */
+
+/**
+ * @brief four channel scan slots definition
+ */
+static const ads1118_slot_t gs_slot[4] =
+{
+    {ADS1118_CHANNEL_AIN0_GND, ADS1118_RANGE_4P096V, ADS1118_RATE_860SPS, ADS1118_MODE_ADC},
+    {ADS1118_CHANNEL_AIN1_GND, ADS1118_RANGE_4P096V, ADS1118_RATE_860SPS, ADS1118_MODE_ADC},
+    {ADS1118_CHANNEL_AIN2_GND, ADS1118_RANGE_4P096V, ADS1118_RATE_860SPS, ADS1118_MODE_ADC},
+    {ADS1118_CHANNEL_AIN3_GND, ADS1118_RANGE_4P096V, ADS1118_RATE_860SPS, ADS1118_MODE_ADC},
+};
+
+/**
+ * @brief     deinit all chips
+ * @param[in] num device number
+ * @note      none
+ */
+static void a_bus_test_deinit(uint8_t num)
+{
+    uint8_t i;
+    
+    for (i = 0; i < num; i++)
+    {
+        (void)ads1118_deinit(&gs_handle[i]);
+    }
+}
+
+/**
+ * @brief     bus test
+ * @param[in] **user pointer to a user context list, one context for every chip
+ * @param[in] num device number
+ * @param[in] times test rounds
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the chips are linked with the ctx interface functions,
+ *            the rounds run in lock step first and then with the interleaved scheduler
+ */
+uint8_t ads1118_bus_test(void **user, uint8_t num, uint32_t times)
+{
+    uint8_t res;
+    uint8_t i;
+    uint32_t j;
+    uint32_t len;
+    uint32_t total;
+    uint32_t expect;
+    uint32_t order_error;
+    uint8_t next_device;
+    uint8_t next_slot[ADS1118_BUS_TEST_MAX];
+    uint64_t start;
+    uint64_t stop;
+    float v;
+    ads1118_sample_t sample;
+    
+    if ((num == 0) || (num > ADS1118_BUS_TEST_MAX))
+    {
+        ads1118_interface_debug_print("ads1118: num is invalid.\n");
+        
+        return 1;
+    }
+    
+    /* start bus test */
+    ads1118_interface_debug_print("ads1118: start bus test.\n");
+    
+    /* init all chips */
+    for (i = 0; i < num; i++)
+    {
+        /* link interface function */
+        DRIVER_ADS1118_LINK_INIT(&gs_handle[i], ads1118_handle_t);
+        DRIVER_ADS1118_LINK_SPI_INIT_CTX(&gs_handle[i], ads1118_interface_spi_init_ctx);
+        DRIVER_ADS1118_LINK_SPI_DEINIT_CTX(&gs_handle[i], ads1118_interface_spi_deinit_ctx);
+        DRIVER_ADS1118_LINK_SPI_TRANSMIT_CTX(&gs_handle[i], ads1118_interface_spi_transmit_ctx);
+        DRIVER_ADS1118_LINK_USER(&gs_handle[i], user[i]);
+        DRIVER_ADS1118_LINK_DELAY_MS(&gs_handle[i], ads1118_interface_delay_ms);
+        DRIVER_ADS1118_LINK_DELAY_US(&gs_handle[i], ads1118_interface_delay_us);
+        DRIVER_ADS1118_LINK_GET_TIME_US(&gs_handle[i], ads1118_interface_get_time_us);
+        DRIVER_ADS1118_LINK_DEBUG_PRINT(&gs_handle[i], ads1118_interface_debug_print);
+        
+        /* ads1118 init */
+        res = ads1118_init(&gs_handle[i]);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: device %d init failed.\n", i);
+            a_bus_test_deinit(i);
+            
+            return 1;
+        }
+        
+        /* set the device */
+        gs_device[i].handle = &gs_handle[i];
+        gs_device[i].slot = gs_slot;
+        gs_device[i].slot_len = 4;
+        next_slot[i] = 0;
+    }
+    
+    /* bus init */
+    res = ads1118_bus_init(&gs_bus, gs_device, num);
+    if (res != 0)
+    {
+        ads1118_interface_debug_print("ads1118: bus init failed.\n");
+        a_bus_test_deinit(num);
+        
+        return 1;
+    }
+    res = ads1118_ring_init(&gs_ring, gs_buf, 64);
+    if (res != 0)
+    {
+        ads1118_interface_debug_print("ads1118: ring init failed.\n");
+        a_bus_test_deinit(num);
+        
+        return 1;
+    }
+    
+    /* run all rounds */
+    total = 0;
+    order_error = 0;
+    next_device = 0;
+    start = ads1118_interface_get_time_us();
+    for (j = 0; j < times; j++)
+    {
+        res = ads1118_bus_round(&gs_bus, &gs_ring);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: bus round failed.\n");
+            a_bus_test_deinit(num);
+            
+            return 1;
+        }
+        
+        /* check the aggregate stream */
+        while (1)
+        {
+            len = 1;
+            (void)ads1118_ring_pop(&gs_ring, &sample, &len);
+            if (len == 0)
+            {
+                break;
+            }
+            if ((sample.device != next_device) ||
+                (sample.channel != gs_slot[next_slot[sample.device]].channel))
+            {
+                order_error++;
+            }
+            if (sample.device < num)
+            {
+                next_slot[sample.device] = (uint8_t)((next_slot[sample.device] + 1) % 4);
+            }
+            next_device = (uint8_t)((sample.device + 1) % num);
+            if (j + 4 >= times)
+            {
+                (void)ads1118_raw_to_volts_n((ads1118_range_t)sample.range, &sample.raw, &v, 1);
+                ads1118_interface_debug_print("ads1118: device %d channel %d %0.3fV.\n",
+                                              sample.device, sample.channel, v);
+            }
+            total++;
+        }
+    }
+    stop = ads1118_interface_get_time_us();
+    
+    /* check the result */
+    expect = (times > 0) ? ((times - 1) * num) : 0;
+    ads1118_interface_debug_print("ads1118: %d samples of %d devices in %d us.\n",
+                                  total, num, (uint32_t)(stop - start));
+    if (stop > start)
+    {
+        ads1118_interface_debug_print("ads1118: aggregate rate is %0.1f sps.\n",
+                                      (float)total * 1000000.0f / (float)(stop - start));
+    }
+    ads1118_interface_debug_print("ads1118: check sample number %s.\n", (total == expect) ? "ok" : "error");
+    ads1118_interface_debug_print("ads1118: check sample order %s.\n", (order_error == 0) ? "ok" : "error");
+    if ((total != expect) || (order_error != 0))
+    {
+        a_bus_test_deinit(num);
+        
+        return 1;
+    }
+    
+    /* restart the bus for the interleaved scheduler */
+    res = ads1118_bus_init(&gs_bus, gs_device, num);
+    if (res != 0)
+    {
+        ads1118_interface_debug_print("ads1118: bus init failed.\n");
+        a_bus_test_deinit(num);
+        
+        return 1;
+    }
+    for (i = 0; i < num; i++)
+    {
+        next_slot[i] = 0;
+    }
+    
+    /* run the interleaved scheduler */
+    total = 0;
+    order_error = 0;
+    start = ads1118_interface_get_time_us();
+    for (j = 0; j < times; j++)
+    {
+        res = ads1118_bus_run(&gs_bus, &gs_ring, num);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: bus run failed.\n");
+            a_bus_test_deinit(num);
+            
+            return 1;
+        }
+        
+        /* every device keeps its own slot order */
+        while (1)
+        {
+            len = 1;
+            (void)ads1118_ring_pop(&gs_ring, &sample, &len);
+            if (len == 0)
+            {
+                break;
+            }
+            if ((sample.device >= num) ||
+                (sample.channel != gs_slot[next_slot[sample.device]].channel))
+            {
+                order_error++;
+            }
+            else
+            {
+                next_slot[sample.device] = (uint8_t)((next_slot[sample.device] + 1) % 4);
+            }
+            total++;
+        }
+    }
+    stop = ads1118_interface_get_time_us();
+    
+    /* check the result */
+    expect = times * num;
+    ads1118_interface_debug_print("ads1118: interleaved %d samples of %d devices in %d us.\n",
+                                  total, num, (uint32_t)(stop - start));
+    if (stop > start)
+    {
+        ads1118_interface_debug_print("ads1118: interleaved aggregate rate is %0.1f sps.\n",
+                                      (float)total * 1000000.0f / (float)(stop - start));
+    }
+    ads1118_interface_debug_print("ads1118: check interleaved sample number %s.\n", (total == expect) ? "ok" : "error");
+    ads1118_interface_debug_print("ads1118: check interleaved sample order %s.\n", (order_error == 0) ? "ok" : "error");
+    
+    /* finish bus test */
+    ads1118_interface_debug_print("ads1118: finish bus test.\n");
+    a_bus_test_deinit(num);
+    
+    return ((total == expect) && (order_error == 0)) ? 0 : 1;
+}
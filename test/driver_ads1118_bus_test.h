@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1118_bus_test.h
+ * @brief     driver ads1118 bus test header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2024-02-28
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2024/02/28  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADS1118_BUS_TEST_H
+#define DRIVER_ADS1118_BUS_TEST_H
+
+#include "driver_ads1118_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup ads1118_test_driver
+ * @{
+ */
+
+/**
+ * @brief ads1118 bus test device number definition
+ */
+#define ADS1118_BUS_TEST_MAX        16        /**< max devices */
+
+/**
+ * @brief     bus test
+ * @param[in] **user pointer to a user context list, one context for every chip
+ * @param[in] num device number
+ * @param[in] times test rounds
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the chips are linked with the ctx interface functions,
+ *            the rounds run in lock step first and then with the interleaved scheduler
+ */
+uint8_t ads1118_bus_test(void **user, uint8_t num, uint32_t times);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
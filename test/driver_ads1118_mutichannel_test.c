@@ -58,7 +58,10 @@ uint8_t ads1118_multichannel_test(ads1118_channel_t channel, uint32_t times)
     DRIVER_ADS1118_LINK_SPI_INIT(&gs_handle, ads1118_interface_spi_init);
     DRIVER_ADS1118_LINK_SPI_DEINIT(&gs_handle, ads1118_interface_spi_deinit);
     DRIVER_ADS1118_LINK_SPI_TRANSMIT(&gs_handle, ads1118_interface_spi_transmit);
+    DRIVER_ADS1118_LINK_SPI_TRANSMIT_BATCH(&gs_handle, ads1118_interface_spi_transmit_batch);
     DRIVER_ADS1118_LINK_DELAY_MS(&gs_handle, ads1118_interface_delay_ms);
+    DRIVER_ADS1118_LINK_DELAY_US(&gs_handle, ads1118_interface_delay_us);
+    DRIVER_ADS1118_LINK_GET_TIME_US(&gs_handle, ads1118_interface_get_time_us);
     DRIVER_ADS1118_LINK_DEBUG_PRINT(&gs_handle, ads1118_interface_debug_print);
     
     /* get information */
@@ -160,6 +163,237 @@ uint8_t ads1118_multichannel_test(ads1118_channel_t channel, uint32_t times)
         ads1118_interface_delay_ms(1000);
     }
     
+    /* start scan test */
+    ads1118_interface_debug_print("ads1118: scan test.\n");
+    for (i = 0; i < times; i++)
+    {
+        int16_t raw[5];
+        float s[5];
+        uint8_t j;
+        ads1118_sample_t sample[5];
+        ads1118_slot_t slot[5] =
+        {
+            {ADS1118_CHANNEL_AIN0_GND, ADS1118_RANGE_6P144V, ADS1118_RATE_128SPS, ADS1118_MODE_ADC},
+            {ADS1118_CHANNEL_AIN1_GND, ADS1118_RANGE_6P144V, ADS1118_RATE_128SPS, ADS1118_MODE_ADC},
+            {ADS1118_CHANNEL_AIN2_GND, ADS1118_RANGE_6P144V, ADS1118_RATE_128SPS, ADS1118_MODE_ADC},
+            {ADS1118_CHANNEL_AIN3_GND, ADS1118_RANGE_6P144V, ADS1118_RATE_128SPS, ADS1118_MODE_ADC},
+            {ADS1118_CHANNEL_AIN0_GND, ADS1118_RANGE_6P144V, ADS1118_RATE_128SPS, ADS1118_MODE_TEMPERATURE},
+        };
+        
+        /* scan all inputs and the temperature sensor */
+        res = ads1118_scan(&gs_handle, slot, 5, raw, s);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: scan failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        ads1118_interface_debug_print("ads1118: %d/%d ain0 %0.2fV ain1 %0.2fV ain2 %0.2fV ain3 %0.2fV temperature %0.2fC.\n",
+                                      i + 1, times, s[0], s[1], s[2], s[3], s[4]);
+        
+        /* scan into timestamped samples */
+        res = ads1118_scan_sample(&gs_handle, slot, 5, sample);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: scan sample failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        for (j = 0; j < 5; j++)
+        {
+            if ((sample[j].channel != slot[j].channel) || (sample[j].range != slot[j].range) ||
+                (sample[j].rate != slot[j].rate) || ((j != 0) && (sample[j].timestamp <= sample[j - 1].timestamp)))
+            {
+                ads1118_interface_debug_print("ads1118: sample record is invalid.\n");
+                (void)ads1118_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        ads1118_interface_debug_print("ads1118: %d/%d scan samples span %dus.\n",
+                                      i + 1, times, (int)(sample[4].timestamp - sample[0].timestamp));
+        ads1118_interface_delay_ms(1000);
+    }
+    
+    /* start convert and fetch test */
+    ads1118_interface_debug_print("ads1118: convert and fetch test.\n");
+    {
+        int16_t raw[5];
+        int16_t ref[2];
+        int32_t diff;
+        uint32_t samples;
+        uint8_t j;
+        ads1118_stats_t stats;
+        ads1118_slot_t slot[2] =
+        {
+            {ADS1118_CHANNEL_AIN1_GND, ADS1118_RANGE_6P144V, ADS1118_RATE_128SPS, ADS1118_MODE_ADC},
+            {ADS1118_CHANNEL_AIN2_GND, ADS1118_RANGE_6P144V, ADS1118_RATE_128SPS, ADS1118_MODE_ADC},
+        };
+        
+        /* pipeline the two slots, every call fetches the slot started by the last call */
+        samples = 0;
+        if (ads1118_get_stats(&gs_handle, &stats) == 0)
+        {
+            samples = stats.samples;
+        }
+        for (j = 0; j < 5; j++)
+        {
+            res = ads1118_convert_and_fetch(&gs_handle, &slot[j % 2], &raw[j]);
+            if (res != 0)
+            {
+                ads1118_interface_debug_print("ads1118: convert and fetch failed.\n");
+                (void)ads1118_deinit(&gs_handle);
+                
+                return 1;
+            }
+            ads1118_interface_delay_ms(10);
+        }
+        
+        /* the first result is stale and not counted */
+        if (ads1118_get_stats(&gs_handle, &stats) == 0)
+        {
+            ads1118_interface_debug_print("ads1118: check stale result %s.\n", (stats.samples - samples == 4) ? "ok" : "error");
+            if (stats.samples - samples != 4)
+            {
+                (void)ads1118_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        
+        /* read the same channels one by one */
+        for (j = 0; j < 2; j++)
+        {
+            res = ads1118_set_channel(&gs_handle, slot[j].channel);
+            if (res != 0)
+            {
+                ads1118_interface_debug_print("ads1118: set channel failed.\n");
+                (void)ads1118_deinit(&gs_handle);
+                
+                return 1;
+            }
+            res = ads1118_single_read(&gs_handle, &ref[j], NULL);
+            if (res != 0)
+            {
+                ads1118_interface_debug_print("ads1118: read failed.\n");
+                (void)ads1118_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        
+        /* raw[j] is the slot started by call j - 1, 16 codes are 3mV in the 6.144V range */
+        for (j = 1; j < 5; j++)
+        {
+            diff = (int32_t)raw[j] - ref[(j - 1) % 2];
+            if ((diff > 16) || (diff < -16))
+            {
+                ads1118_interface_debug_print("ads1118: %d/4 fetch %d single read %d.\n", j, raw[j], ref[(j - 1) % 2]);
+                (void)ads1118_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        ads1118_interface_debug_print("ads1118: ain1 %d ain2 %d match the single read %d %d.\n", raw[3], raw[4], ref[0], ref[1]);
+    }
+    
+    /* start thermocouple test */
+    ads1118_interface_debug_print("ads1118: thermocouple test.\n");
+    {
+        float mv;
+        float deg;
+        float t[8];
+        float cj;
+        uint8_t j;
+        ads1118_thermocouple_t tc;
+        const float emf[5] = {4.096f, 5.269f, 4.279f, 6.319f, 2.774f};
+        const char *name[5] = {"k", "j", "t", "e", "n"};
+        
+        for (j = 0; j < 5; j++)
+        {
+            /* check the nist table at 100C */
+            res = ads1118_thermocouple_deg_to_mv((ads1118_thermocouple_type_t)j, 100.0f, &mv);
+            if ((res != 0) || (mv - emf[j] > 0.001f) || (emf[j] - mv > 0.001f))
+            {
+                ads1118_interface_debug_print("ads1118: %s type emf is invalid.\n", name[j]);
+                (void)ads1118_deinit(&gs_handle);
+                
+                return 1;
+            }
+            
+            /* check the inverse table */
+            res = ads1118_thermocouple_mv_to_deg((ads1118_thermocouple_type_t)j, mv, &deg);
+            if ((res != 0) || (deg - 100.0f > 0.06f) || (100.0f - deg > 0.06f))
+            {
+                ads1118_interface_debug_print("ads1118: %s type inverse is invalid.\n", name[j]);
+                (void)ads1118_deinit(&gs_handle);
+                
+                return 1;
+            }
+            ads1118_interface_debug_print("ads1118: %s type 100.00C is %0.3fmV and back %0.2fC.\n", name[j], mv, deg);
+        }
+        
+        /* k type thermocouple on ain2 and ain3 */
+        res = ads1118_thermocouple_init(&tc, ADS1118_THERMOCOUPLE_TYPE_K, ADS1118_CHANNEL_AIN2_AIN3,
+                                        ADS1118_RANGE_0P256V, ADS1118_RATE_128SPS, 4);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: thermocouple init failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = ads1118_thermocouple_read(&gs_handle, &tc, t, 8);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: thermocouple read failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = ads1118_thermocouple_get_cold_junction(&tc, &cj);
+        if ((res != 0) || (cj < -40.0f) || (cj > 125.0f))
+        {
+            ads1118_interface_debug_print("ads1118: cold junction is invalid.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        for (j = 0; j < 8; j++)
+        {
+            ads1118_interface_debug_print("ads1118: %d/8 cold junction %0.2fC thermocouple %0.2fC.\n", j + 1, cj, t[j]);
+        }
+        
+        /* check the lookup table against the polynomials */
+        for (j = 0; j < 5; j++)
+        {
+            int16_t code = (int16_t)(j * 1500 - 500);
+            int32_t uv;
+            int32_t mdeg;
+            
+            (void)ads1118_raw_to_microvolts(ADS1118_RANGE_0P256V, code, &uv);
+            res = ads1118_thermocouple_convert_n(&tc, &uv, &deg, 1);
+            if (res != 0)
+            {
+                ads1118_interface_debug_print("ads1118: thermocouple convert failed.\n");
+                (void)ads1118_deinit(&gs_handle);
+                
+                return 1;
+            }
+            res = ads1118_thermocouple_raw_to_mdeg_n(&tc, &code, &mdeg, 1);
+            if ((res != 0) || ((float)mdeg * 0.001f - deg > 0.3f) || (deg - (float)mdeg * 0.001f > 0.3f))
+            {
+                ads1118_interface_debug_print("ads1118: thermocouple lookup is invalid.\n");
+                (void)ads1118_deinit(&gs_handle);
+                
+                return 1;
+            }
+            ads1118_interface_debug_print("ads1118: raw %d polynomial %0.2fC lookup %0.3fC.\n", code, deg, (float)mdeg * 0.001f);
+        }
+    }
+    
     /* finish multichannel test */
     ads1118_interface_debug_print("ads1118: finish multichannel test.\n");
     (void)ads1118_deinit(&gs_handle);
@@ -57,7 +57,10 @@ uint8_t ads1118_read_test(uint32_t times)
     DRIVER_ADS1118_LINK_SPI_INIT(&gs_handle, ads1118_interface_spi_init);
     DRIVER_ADS1118_LINK_SPI_DEINIT(&gs_handle, ads1118_interface_spi_deinit);
     DRIVER_ADS1118_LINK_SPI_TRANSMIT(&gs_handle, ads1118_interface_spi_transmit);
+    DRIVER_ADS1118_LINK_SPI_TRANSMIT_BATCH(&gs_handle, ads1118_interface_spi_transmit_batch);
     DRIVER_ADS1118_LINK_DELAY_MS(&gs_handle, ads1118_interface_delay_ms);
+    DRIVER_ADS1118_LINK_DELAY_US(&gs_handle, ads1118_interface_delay_us);
+    DRIVER_ADS1118_LINK_GET_TIME_US(&gs_handle, ads1118_interface_get_time_us);
     DRIVER_ADS1118_LINK_DEBUG_PRINT(&gs_handle, ads1118_interface_debug_print);
     
     /* get information */
@@ -178,6 +181,217 @@ uint8_t ads1118_read_test(uint32_t times)
         ads1118_interface_delay_ms(1000);
     }
     
+    /* continuous read block test */
+    ads1118_interface_debug_print("ads1118: continuous read block test.\n");
+    for (i = 0; i < times; i++)
+    {
+        int16_t raw[8];
+        float s[8];
+        
+        /* continuous read block */
+        res = ads1118_continuous_read_block(&gs_handle, (int16_t *)raw, (float *)s, 8);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: read block failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        ads1118_interface_debug_print("ads1118: %d continues block %0.3fV ... %0.3fV.\n", i + 1, s[0], s[7]);
+        ads1118_interface_delay_ms(1000);
+    }
+    
+    /* continuous status test */
+    ads1118_interface_debug_print("ads1118: continuous status test.\n");
+    {
+        int16_t raw;
+        float s;
+        uint32_t skipped;
+        ads1118_continuous_status_t status;
+        ads1118_continuous_count_t count;
+        
+        /* clear the counts */
+        res = ads1118_clear_continuous_count(&gs_handle);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: clear continuous count failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* a read right after another one gets the same conversion */
+        res = ads1118_continuous_read(&gs_handle, (int16_t *)&raw, (float *)&s);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: read failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = ads1118_continuous_read(&gs_handle, (int16_t *)&raw, (float *)&s);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: read failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = ads1118_get_continuous_status(&gs_handle, &status, &skipped);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: get continuous status failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        ads1118_interface_debug_print("ads1118: back to back read is %s.\n",
+                                      (status == ADS1118_CONTINUOUS_STATUS_DUPLICATE) ? "duplicate" : "fresh");
+        if (status != ADS1118_CONTINUOUS_STATUS_DUPLICATE)
+        {
+            ads1118_interface_debug_print("ads1118: check continuous status error.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* 128sps makes 5 conversions in 40ms */
+        ads1118_interface_delay_ms(40);
+        res = ads1118_continuous_read(&gs_handle, (int16_t *)&raw, (float *)&s);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: read failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = ads1118_get_continuous_status(&gs_handle, &status, &skipped);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: get continuous status failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        ads1118_interface_debug_print("ads1118: slow read skipped %d conversions.\n", skipped);
+        if ((status != ADS1118_CONTINUOUS_STATUS_SKIPPED) || (skipped < 4) || (skipped > 5))
+        {
+            ads1118_interface_debug_print("ads1118: check continuous status error.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = ads1118_get_continuous_count(&gs_handle, &count);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: get continuous count failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        ads1118_interface_debug_print("ads1118: fresh %d duplicate %d skipped %d.\n",
+                                      count.fresh, count.duplicate, count.skipped);
+        if ((count.fresh != 2) || (count.duplicate != 1) || (count.skipped < skipped))
+        {
+            ads1118_interface_debug_print("ads1118: check continuous count error.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    
+    /* filter test */
+    ads1118_interface_debug_print("ads1118: filter test.\n");
+    {
+        const int16_t coef[16] =
+        {
+            -42, -177, -406, -352, 669, 2961, 5846, 7885,
+            7885, 5846, 2961, 669, -352, -406, -177, -42,
+        };
+        int16_t history[32];
+        int16_t raw[61];
+        int32_t out[64];
+        float s[4];
+        uint32_t n;
+        uint32_t j;
+        uint32_t total;
+        uint8_t k;
+        ads1118_filter_t filter;
+        
+        for (k = 0; k < 3; k++)
+        {
+            if (k == 0)
+            {
+                res = ads1118_filter_boxcar_init(&filter, 16);
+            }
+            else if (k == 1)
+            {
+                res = ads1118_filter_cic_init(&filter, 16, 3);
+            }
+            else
+            {
+                res = ads1118_filter_fir_init(&filter, 4, coef, history, 16);
+            }
+            if (res != 0)
+            {
+                ads1118_interface_debug_print("ads1118: filter init failed.\n");
+                (void)ads1118_deinit(&gs_handle);
+                
+                return 1;
+            }
+            
+            /* a constant input comes out with the fraction bits once the filter is settled */
+            for (j = 0; j < 61; j++)
+            {
+                raw[j] = -1000;
+            }
+            total = 0;
+            for (i = 0; i < 16; i++)
+            {
+                (void)ads1118_filter_process(&filter, raw, 61, out, &n);
+                for (j = 0; j < n; j++)
+                {
+                    if ((total + j >= 4) && (out[j] != -1000 * (1 << ADS1118_FILTER_FRAC_BITS)))
+                    {
+                        ads1118_interface_debug_print("ads1118: filter %d output %d is wrong.\n", k, out[j]);
+                        (void)ads1118_deinit(&gs_handle);
+                        
+                        return 1;
+                    }
+                }
+                total += n;
+            }
+            if (total != (16 * 61) / filter.ratio)
+            {
+                ads1118_interface_debug_print("ads1118: filter %d output length is wrong.\n", k);
+                (void)ads1118_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        ads1118_interface_debug_print("ads1118: check filter ok.\n");
+        
+        /* decimate by 16 with a third order cic, the first output fills the combs */
+        res = ads1118_filter_cic_init(&filter, 16, 3);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: filter init failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = ads1118_continuous_read_filter(&gs_handle, &filter, out, 4);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: continuous read filter failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        (void)ads1118_filter_to_volts_n(ADS1118_RANGE_6P144V, out, s, 4);
+        ads1118_interface_debug_print("ads1118: filtered %0.5fV %0.5fV %0.5fV %0.5fV.\n", s[0], s[1], s[2], s[3]);
+    }
+    
     /* stop continuous read */
     res = ads1118_stop_continuous_read(&gs_handle);
     if (res != 0)
@@ -208,6 +422,439 @@ uint8_t ads1118_read_test(uint32_t times)
         ads1118_interface_delay_ms(1000);
     }
     
+    /* start async single read */
+    ads1118_interface_debug_print("ads1118: async single read test.\n");
+    for (i = 0; i < times; i++)
+    {
+        int16_t raw;
+        float s;
+        uint64_t ready_us;
+        uint32_t polls;
+        ads1118_bool_t ready;
+        
+        /* start the conversion */
+        res = ads1118_single_start(&gs_handle, &ready_us);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: single start failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* other work can run between the polls */
+        polls = 0;
+        ready = ADS1118_BOOL_FALSE;
+        while (ready == ADS1118_BOOL_FALSE)
+        {
+            res = ads1118_single_is_ready(&gs_handle, &ready);
+            if (res != 0)
+            {
+                ads1118_interface_debug_print("ads1118: single is ready failed.\n");
+                (void)ads1118_deinit(&gs_handle);
+                
+                return 1;
+            }
+            if (ready == ADS1118_BOOL_FALSE)
+            {
+                ads1118_interface_delay_us(100);
+                polls++;
+            }
+        }
+        
+        /* fetch the result */
+        res = ads1118_single_fetch(&gs_handle, (int16_t *)&raw, (float *)&s);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: single fetch failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        if (ads1118_interface_get_time_us() < ready_us)
+        {
+            ads1118_interface_debug_print("ads1118: result is fetched before the ready time.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        ads1118_interface_debug_print("ads1118: %d async single mode %0.3fV after %d polls.\n", i + 1, s, polls);
+        ads1118_interface_delay_ms(1000);
+    }
+    
+    /* timestamped sample test */
+    ads1118_interface_debug_print("ads1118: timestamped sample test.\n");
+    {
+        ads1118_sample_t sample[4];
+        uint64_t last;
+        
+        /* single read samples */
+        last = 0;
+        for (i = 0; i < times; i++)
+        {
+            res = ads1118_single_read_sample(&gs_handle, &sample[0]);
+            if (res != 0)
+            {
+                ads1118_interface_debug_print("ads1118: single read sample failed.\n");
+                (void)ads1118_deinit(&gs_handle);
+                
+                return 1;
+            }
+            if ((sample[0].timestamp <= last) || (sample[0].channel != ADS1118_CHANNEL_AIN0_GND) ||
+                (sample[0].range != ADS1118_RANGE_6P144V) || (sample[0].rate != ADS1118_RATE_128SPS))
+            {
+                ads1118_interface_debug_print("ads1118: sample record is invalid.\n");
+                (void)ads1118_deinit(&gs_handle);
+                
+                return 1;
+            }
+            last = sample[0].timestamp;
+            ads1118_interface_debug_print("ads1118: %d sample raw %d at %lluus.\n", i + 1, sample[0].raw,
+                                          (unsigned long long)sample[0].timestamp);
+        }
+        
+        /* continuous read samples */
+        res = ads1118_start_continuous_read(&gs_handle);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: start continuous read failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        ads1118_interface_delay_ms(100);
+        res = ads1118_continuous_read_sample(&gs_handle, sample, 4);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: continuous read sample failed.\n");
+            (void)ads1118_stop_continuous_read(&gs_handle);
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = ads1118_stop_continuous_read(&gs_handle);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: stop continuous read failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        for (i = 0; i < 4; i++)
+        {
+            if ((sample[i].timestamp <= last) || (sample[i].rate != ADS1118_RATE_128SPS))
+            {
+                ads1118_interface_debug_print("ads1118: sample timestamp is not monotonic.\n");
+                (void)ads1118_deinit(&gs_handle);
+                
+                return 1;
+            }
+            last = sample[i].timestamp;
+        }
+        ads1118_interface_debug_print("ads1118: continuous sample period is %dus.\n",
+                                      (int)((sample[3].timestamp - sample[0].timestamp) / 3));
+    }
+    
+    /* auto range test */
+    ads1118_interface_debug_print("ads1118: auto range test.\n");
+    {
+        int16_t raw;
+        float s;
+        ads1118_range_t range;
+        
+        /* single read from the 6.144V range */
+        res = ads1118_set_autorange(&gs_handle, ADS1118_BOOL_TRUE);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: set autorange failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        for (i = 0; i < 4; i++)
+        {
+            res = ads1118_single_read(&gs_handle, (int16_t *)&raw, (float *)&s);
+            if (res != 0)
+            {
+                ads1118_interface_debug_print("ads1118: read failed.\n");
+                (void)ads1118_deinit(&gs_handle);
+                
+                return 1;
+            }
+            (void)ads1118_get_range(&gs_handle, &range);
+            ads1118_interface_debug_print("ads1118: %d auto range %d raw %d %0.3fV.\n", i + 1, range, raw, s);
+        }
+        (void)ads1118_get_autorange_range(&gs_handle, ADS1118_CHANNEL_AIN0_GND, &range);
+        if ((range != ADS1118_RANGE_4P096V) || (raw >= ADS1118_AUTORANGE_HIGH) || (raw < ADS1118_AUTORANGE_LOW))
+        {
+            ads1118_interface_debug_print("ads1118: auto range does not settle.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* continuous read from a saturated 0.256V range */
+        res = ads1118_set_autorange_range(&gs_handle, ADS1118_CHANNEL_AIN0_GND, ADS1118_RANGE_0P256V);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: set autorange range failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = ads1118_start_continuous_read(&gs_handle);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: start continuous read failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        for (i = 0; i < 8; i++)
+        {
+            ads1118_interface_delay_ms(10);
+            res = ads1118_continuous_read(&gs_handle, (int16_t *)&raw, (float *)&s);
+            if (res != 0)
+            {
+                ads1118_interface_debug_print("ads1118: continuous read failed.\n");
+                (void)ads1118_stop_continuous_read(&gs_handle);
+                (void)ads1118_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        res = ads1118_stop_continuous_read(&gs_handle);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: stop continuous read failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        (void)ads1118_get_autorange_range(&gs_handle, ADS1118_CHANNEL_AIN0_GND, &range);
+        
+        /* coming from above the input stays in the 2.048V range within the hysteresis */
+        if ((range != ADS1118_RANGE_2P048V) || (raw >= ADS1118_AUTORANGE_HIGH) || (s < 1.5f) || (s > 1.8f))
+        {
+            ads1118_interface_debug_print("ads1118: continuous auto range does not settle.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        ads1118_interface_debug_print("ads1118: continuous auto range %d %0.3fV.\n", range, s);
+        
+        /* back to the fixed range */
+        res = ads1118_set_autorange(&gs_handle, ADS1118_BOOL_FALSE);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: set autorange failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = ads1118_set_range(&gs_handle, ADS1118_RANGE_6P144V);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: set range failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    
+    /* calibration test */
+    ads1118_interface_debug_print("ads1118: calibration test.\n");
+    {
+        const int16_t code[4] = {10000, -10000, 32767, -32768};
+        const int16_t expect[4] = {9999, -10201, 32767, -32768};
+        int16_t out[4];
+        int16_t raw;
+        int16_t offset;
+        float s;
+        ads1118_calibration_t cal;
+        
+        /* integer and float correction */
+        cal.offset = 100;
+        cal.gain = 33096;
+        res = ads1118_set_calibration_entry(&gs_handle, ADS1118_CHANNEL_AIN0_GND, ADS1118_RANGE_6P144V, &cal);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: set calibration entry failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        (void)ads1118_calibrate_n(&gs_handle, ADS1118_CHANNEL_AIN0_GND, ADS1118_RANGE_6P144V, code, out, 4);
+        (void)ads1118_calibrate_to_volts_n(&gs_handle, ADS1118_CHANNEL_AIN0_GND, ADS1118_RANGE_6P144V, code, &s, 1);
+        for (i = 0; i < 4; i++)
+        {
+            if (out[i] != expect[i])
+            {
+                ads1118_interface_debug_print("ads1118: calibrate %d is %d, not %d.\n", code[i], out[i], expect[i]);
+                (void)ads1118_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        s -= 9900.0f * 33096.0f / 32768.0f * 6.144f / 32768.0f;
+        if ((s > 1e-5f) || (s < -1e-5f))
+        {
+            ads1118_interface_debug_print("ads1118: calibrate to volts is %0.6fV off.\n", s);
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        cal.offset = 0;
+        cal.gain = 32768;
+        (void)ads1118_set_calibration_entry(&gs_handle, ADS1118_CHANNEL_AIN0_GND, ADS1118_RANGE_6P144V, &cal);
+        ads1118_interface_debug_print("ads1118: check calibrate ok.\n");
+        
+        /* offset capture with the dc level of the inputs */
+        res = ads1118_capture_offset(&gs_handle, ADS1118_CHANNEL_AIN1_AIN3, ADS1118_RANGE_2P048V, 8, &offset);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: capture offset failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        (void)ads1118_get_calibration_entry(&gs_handle, ADS1118_CHANNEL_AIN1_AIN3, ADS1118_RANGE_2P048V, &cal);
+        if (cal.offset != offset)
+        {
+            ads1118_interface_debug_print("ads1118: captured offset is not saved.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = ads1118_set_channel(&gs_handle, ADS1118_CHANNEL_AIN1_AIN3);
+        res |= ads1118_set_range(&gs_handle, ADS1118_RANGE_2P048V);
+        res |= ads1118_set_calibration(&gs_handle, ADS1118_BOOL_TRUE);
+        res |= ads1118_single_read(&gs_handle, (int16_t *)&raw, (float *)&s);
+        res |= ads1118_set_calibration(&gs_handle, ADS1118_BOOL_FALSE);
+        res |= ads1118_set_channel(&gs_handle, ADS1118_CHANNEL_AIN0_GND);
+        res |= ads1118_set_range(&gs_handle, ADS1118_RANGE_6P144V);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: calibrated read failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        if ((raw > 16) || (raw < -16) || (s > 0.001f) || (s < -0.001f))
+        {
+            ads1118_interface_debug_print("ads1118: calibrated read is %d %0.6fV.\n", raw, s);
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        ads1118_interface_debug_print("ads1118: offset %d is removed to %d.\n", offset, raw);
+    }
+    
+    /* microvolt convert test */
+    ads1118_interface_debug_print("ads1118: microvolt convert test.\n");
+    {
+        const float fsr[6] = {6.144f, 4.096f, 2.048f, 1.024f, 0.512f, 0.256f};
+        const int32_t fsr_uv[6] = {6144000, 4096000, 2048000, 1024000, 512000, 256000};
+        int32_t r;
+        int32_t uv;
+        uint8_t k;
+        
+        for (k = 0; k < 6; k++)
+        {
+            for (r = -32768; r <= 32767; r++)
+            {
+                double e;
+                float s;
+                
+                /* convert */
+                res = ads1118_raw_to_microvolts((ads1118_range_t)k, (int16_t)r, &uv);
+                if (res != 0)
+                {
+                    ads1118_interface_debug_print("ads1118: raw to microvolts failed.\n");
+                    (void)ads1118_deinit(&gs_handle);
+                    
+                    return 1;
+                }
+                
+                /* the exact value only has 4 fraction bits, so the double rounding is exact */
+                e = (double)r * (double)fsr_uv[k] / 32768.0;
+                e = (e < 0) ? -(double)(int32_t)(-e + 0.5) : (double)(int32_t)(e + 0.5);
+                
+                /* the float path is within 1uV of the exact value */
+                s = (float)r * fsr[k] / 32768.0f;
+                if (((double)uv != e) || ((double)s * 1000000.0 - (double)uv > 1.0) ||
+                    ((double)uv - (double)s * 1000000.0 > 1.0))
+                {
+                    ads1118_interface_debug_print("ads1118: range %d raw %d convert %duV is wrong.\n", k, r, uv);
+                    (void)ads1118_deinit(&gs_handle);
+                    
+                    return 1;
+                }
+            }
+        }
+        ads1118_interface_debug_print("ads1118: check microvolt convert ok.\n");
+    }
+    
+    /* bulk convert test */
+    ads1118_interface_debug_print("ads1118: bulk convert test.\n");
+    {
+        const float fsr[6] = {6.144f, 4.096f, 2.048f, 1.024f, 0.512f, 0.256f};
+        int16_t raw[61];
+        float s[61];
+        float d;
+        int32_t r;
+        uint32_t j;
+        uint8_t k;
+        
+        for (k = 0; k < 7; k++)
+        {
+            /* an odd block length also covers the scalar tail */
+            for (r = -32768; r <= 32767; r += 61)
+            {
+                for (j = 0; j < 61; j++)
+                {
+                    raw[j] = (int16_t)((r + (int32_t)j > 32767) ? 32767 : (r + (int32_t)j));
+                }
+                if (k < 6)
+                {
+                    res = ads1118_raw_to_volts_n((ads1118_range_t)k, raw, s, 61);
+                }
+                else
+                {
+                    res = ads1118_raw_to_celsius_n(raw, s, 61);
+                }
+                if (res != 0)
+                {
+                    ads1118_interface_debug_print("ads1118: bulk convert failed.\n");
+                    (void)ads1118_deinit(&gs_handle);
+                    
+                    return 1;
+                }
+                
+                /* compare with the scalar conversion */
+                for (j = 0; j < 61; j++)
+                {
+                    if (k < 6)
+                    {
+                        d = (float)raw[j] * fsr[k] / 32768.0f;
+                    }
+                    else
+                    {
+                        (void)ads1118_temperature_convert(&gs_handle, raw[j], &d);
+                    }
+                    if (d != s[j])
+                    {
+                        ads1118_interface_debug_print("ads1118: bulk convert %d raw %d is wrong.\n", k, raw[j]);
+                        (void)ads1118_deinit(&gs_handle);
+                        
+                        return 1;
+                    }
+                }
+            }
+        }
+        ads1118_interface_debug_print("ads1118: check bulk convert ok.\n");
+    }
+    
     /* set temperature mode */
     res = ads1118_set_mode(&gs_handle, ADS1118_MODE_TEMPERATURE);
     if (res != 0)
@@ -55,13 +55,20 @@ uint8_t ads1118_register_test(void)
     ads1118_rate_t rate;
     ads1118_bool_t enable;
     ads1118_mode_t mode;
+    ads1118_stats_t stats;
+    ads1118_trace_t trace[4];
+    uint32_t len;
+    uint32_t batch_frames;
 
     /* link interface function */
     DRIVER_ADS1118_LINK_INIT(&gs_handle, ads1118_handle_t); 
     DRIVER_ADS1118_LINK_SPI_INIT(&gs_handle, ads1118_interface_spi_init);
     DRIVER_ADS1118_LINK_SPI_DEINIT(&gs_handle, ads1118_interface_spi_deinit);
     DRIVER_ADS1118_LINK_SPI_TRANSMIT(&gs_handle, ads1118_interface_spi_transmit);
+    DRIVER_ADS1118_LINK_SPI_TRANSMIT_BATCH(&gs_handle, ads1118_interface_spi_transmit_batch);
     DRIVER_ADS1118_LINK_DELAY_MS(&gs_handle, ads1118_interface_delay_ms);
+    DRIVER_ADS1118_LINK_DELAY_US(&gs_handle, ads1118_interface_delay_us);
+    DRIVER_ADS1118_LINK_GET_TIME_US(&gs_handle, ads1118_interface_get_time_us);
     DRIVER_ADS1118_LINK_DEBUG_PRINT(&gs_handle, ads1118_interface_debug_print);
     
     /* get information */
@@ -633,6 +640,274 @@ uint8_t ads1118_register_test(void)
     }
     ads1118_interface_debug_print("ads1118: check dout pull up %s.\n", enable == ADS1118_BOOL_TRUE ? "ok" : "error");
     
+    /* ads1118_verify_config/ads1118_sync_config test */
+    ads1118_interface_debug_print("ads1118: ads1118_verify_config/ads1118_sync_config test.\n");
+    
+    /* verify config */
+    res = ads1118_verify_config(&gs_handle, &enable);
+    if (res != 0)
+    {
+        ads1118_interface_debug_print("ads1118: verify config failed.\n");
+        (void)ads1118_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ads1118_interface_debug_print("ads1118: check config %s.\n", enable == ADS1118_BOOL_TRUE ? "ok" : "error");
+    
+    /* sync config */
+    res = ads1118_sync_config(&gs_handle);
+    if (res != 0)
+    {
+        ads1118_interface_debug_print("ads1118: sync config failed.\n");
+        (void)ads1118_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ads1118_get_rate(&gs_handle, &rate);
+    if (res != 0)
+    {
+        ads1118_interface_debug_print("ads1118: get rate failed.\n");
+        (void)ads1118_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ads1118_interface_debug_print("ads1118: check sync config %s.\n", rate == ADS1118_RATE_860SPS ? "ok" : "error");
+    
+    /* ads1118_batch_begin/ads1118_batch_end test */
+    ads1118_interface_debug_print("ads1118: ads1118_batch_begin/ads1118_batch_end test.\n");
+    
+    /* batch begin */
+    res = ads1118_batch_begin(&gs_handle);
+    if (res != 0)
+    {
+        ads1118_interface_debug_print("ads1118: batch begin failed.\n");
+        (void)ads1118_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ads1118_set_channel(&gs_handle, ADS1118_CHANNEL_AIN1_GND);
+    if (res != 0)
+    {
+        ads1118_interface_debug_print("ads1118: set channel failed.\n");
+        (void)ads1118_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ads1118_set_range(&gs_handle, ADS1118_RANGE_2P048V);
+    if (res != 0)
+    {
+        ads1118_interface_debug_print("ads1118: set range failed.\n");
+        (void)ads1118_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ads1118_set_rate(&gs_handle, ADS1118_RATE_128SPS);
+    if (res != 0)
+    {
+        ads1118_interface_debug_print("ads1118: set rate failed.\n");
+        (void)ads1118_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* batch end */
+    res = ads1118_batch_end(&gs_handle);
+    if (res != 0)
+    {
+        ads1118_interface_debug_print("ads1118: batch end failed.\n");
+        (void)ads1118_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ads1118_verify_config(&gs_handle, &enable);
+    if (res != 0)
+    {
+        ads1118_interface_debug_print("ads1118: verify config failed.\n");
+        (void)ads1118_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ads1118_interface_debug_print("ads1118: check batch config %s.\n", enable == ADS1118_BOOL_TRUE ? "ok" : "error");
+    
+    /* start the continuous mode inside a batch */
+    res = ads1118_batch_begin(&gs_handle);
+    if (res != 0)
+    {
+        ads1118_interface_debug_print("ads1118: batch begin failed.\n");
+        (void)ads1118_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ads1118_set_channel(&gs_handle, ADS1118_CHANNEL_AIN0_GND);
+    if (res != 0)
+    {
+        ads1118_interface_debug_print("ads1118: set channel failed.\n");
+        (void)ads1118_deinit(&gs_handle);
+        
+        return 1;
+    }
+    batch_frames = 0;
+    if (ads1118_get_stats(&gs_handle, &stats) == 0)
+    {
+        batch_frames = stats.transfers;
+    }
+    res = ads1118_start_continuous_read(&gs_handle);
+    if (res != 0)
+    {
+        ads1118_interface_debug_print("ads1118: start continuous read failed.\n");
+        (void)ads1118_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* the mode write is sent at once after the queued channel write */
+    if (ads1118_get_stats(&gs_handle, &stats) == 0)
+    {
+        ads1118_interface_debug_print("ads1118: check batch mode write %s.\n",
+                                      (stats.transfers - batch_frames == 2) ? "ok" : "error");
+        if (stats.transfers - batch_frames != 2)
+        {
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    res = ads1118_verify_config(&gs_handle, &enable);
+    if (res != 0)
+    {
+        ads1118_interface_debug_print("ads1118: verify config failed.\n");
+        (void)ads1118_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ads1118_interface_debug_print("ads1118: check batch continuous start %s.\n", enable == ADS1118_BOOL_TRUE ? "ok" : "error");
+    if (enable != ADS1118_BOOL_TRUE)
+    {
+        (void)ads1118_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ads1118_stop_continuous_read(&gs_handle);
+    if (res != 0)
+    {
+        ads1118_interface_debug_print("ads1118: stop continuous read failed.\n");
+        (void)ads1118_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ads1118_batch_end(&gs_handle);
+    if (res != 0)
+    {
+        ads1118_interface_debug_print("ads1118: batch end failed.\n");
+        (void)ads1118_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* ads1118_get_stats/ads1118_clear_stats test */
+    ads1118_interface_debug_print("ads1118: ads1118_get_stats/ads1118_clear_stats test.\n");
+    
+    /* clear stats */
+    res = ads1118_clear_stats(&gs_handle);
+    if (res == 4)
+    {
+        ads1118_interface_debug_print("ads1118: stats is disabled.\n");
+    }
+    else if (res != 0)
+    {
+        ads1118_interface_debug_print("ads1118: clear stats failed.\n");
+        (void)ads1118_deinit(&gs_handle);
+        
+        return 1;
+    }
+    else
+    {
+        res = ads1118_set_channel(&gs_handle, ADS1118_CHANNEL_AIN0_GND);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: set channel failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = ads1118_verify_config(&gs_handle, &enable);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: verify config failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = ads1118_get_stats(&gs_handle, &stats);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: get stats failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        ads1118_interface_debug_print("ads1118: transfers %u, bytes %u, config reads %u, config writes %u.\n",
+                                      (unsigned int)stats.transfers, (unsigned int)stats.bytes,
+                                      (unsigned int)stats.config_reads, (unsigned int)stats.config_writes);
+        ads1118_interface_debug_print("ads1118: check stats %s.\n",
+                                      ((stats.transfers == 2) && (stats.bytes == 6) &&
+                                       (stats.config_reads == 1) && (stats.config_writes == 1)) ? "ok" : "error");
+    }
+    
+    /* ads1118_set_trace/ads1118_get_trace test */
+    ads1118_interface_debug_print("ads1118: ads1118_set_trace/ads1118_get_trace test.\n");
+    
+    /* enable trace */
+    res = ads1118_set_trace(&gs_handle, ADS1118_BOOL_TRUE);
+    if (res == 4)
+    {
+        ads1118_interface_debug_print("ads1118: trace is disabled.\n");
+    }
+    else if (res != 0)
+    {
+        ads1118_interface_debug_print("ads1118: set trace failed.\n");
+        (void)ads1118_deinit(&gs_handle);
+        
+        return 1;
+    }
+    else
+    {
+        res = ads1118_set_channel(&gs_handle, ADS1118_CHANNEL_AIN1_GND);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: set channel failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = ads1118_verify_config(&gs_handle, &enable);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: verify config failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        len = 4;
+        res = ads1118_get_trace(&gs_handle, trace, &len);
+        if (res != 0)
+        {
+            ads1118_interface_debug_print("ads1118: get trace failed.\n");
+            (void)ads1118_deinit(&gs_handle);
+            
+            return 1;
+        }
+        ads1118_interface_debug_print("ads1118: check trace %s.\n",
+                                      ((len == 2) && (trace[0].type == ADS1118_TRACE_TYPE_WRITE) &&
+                                       (trace[0].api == ADS1118_API_SET_CHANNEL) &&
+                                       (trace[1].type == ADS1118_TRACE_TYPE_READ_CONFIG) &&
+                                       (trace[1].len == 4)) ? "ok" : "error");
+        
+        /* dump trace */
+        (void)ads1118_trace_dump(&gs_handle);
+        (void)ads1118_set_trace(&gs_handle, ADS1118_BOOL_FALSE);
+    }
+    
     /* finish register */
     ads1118_interface_debug_print("ads1118: finish register test.\n");
     (void)ads1118_deinit(&gs_handle);